@@ -7,9 +7,11 @@
 #include <map>
 #include <string>
 #include <iomanip>
+#include <sstream>
 #include <cmath>
 #include <nlohmann/json.hpp>
 #include "../simulation/SimulationEngine.hpp"
+#include "ExecuteurReplications.hpp"
 #include "../enums/AlgorithmeOrdonnancement.hpp"
 
 using json = nlohmann::json;
@@ -39,6 +41,14 @@ struct ResultatSimulation {
     int nombreElectifs;
     int nombreAmbulatoires;
     
+    // Vitesse du moteur (réplications uniquement, 0 sinon)
+    double evenementsParSeconde = 0.0;
+    
+    // Temps de calcul d'une décision d'ordonnancement
+    double tempsDecisionMoyenMicrosecondes = 0.0;
+    double tempsDecisionMaxMicrosecondes = 0.0;
+    uint64_t depassementsBudget = 0;
+    
     // Calcul du score global (plus bas = meilleur)
     double calculerScore() const {
         // Pondération: urgences plus importantes que électifs
@@ -74,6 +84,7 @@ public:
         
         SimulationEngine engine(1, config);
         engine.demarrer();
+        Journal::vider();
         
         auto stats = engine.getStatistiques();
         
@@ -96,22 +107,64 @@ public:
         resultat.nombreElectifs = stats["parPriorite"]["ELECTIVE"]["nombre"];
         resultat.nombreAmbulatoires = stats["parPriorite"]["AMBULATOIRE"]["nombre"];
         
+        resultat.tempsDecisionMoyenMicrosecondes = stats["decisions"]["tempsMoyenMicrosecondes"];
+        resultat.tempsDecisionMaxMicrosecondes = stats["decisions"]["tempsMaxMicrosecondes"];
+        resultat.depassementsBudget = stats["decisions"]["depassementsBudget"];
+        
         return resultat;
     }
     
     /**
-     * Compare tous les algorithmes d'ordonnancement
+     * Exécute nombreReplications réplications et retient les moyennes
      */
-    void comparerAlgorithmes(const ConfigSimulation& configBase) {
+    ResultatSimulation executerReplications(const ConfigSimulation& config, size_t nombreReplications) {
+        ResultatReplications replications = ExecuteurReplications().executer(config, nombreReplications);
+        ExecuteurReplications::afficher(replications);
+
+        ResultatSimulation resultat;
+        resultat.nomAlgorithme = algorithmeToString(config.algorithme);
+        resultat.algorithme = config.algorithme;
+        resultat.nombrePatientsTotal = static_cast<int>(std::lround(replications.get(IndicateurReplication::PATIENTS_TOTAL).moyenne));
+        resultat.nombrePatientsTraites = static_cast<int>(std::lround(replications.get(IndicateurReplication::PATIENTS_TRAITES).moyenne));
+        resultat.tempsAttenteMoyen = replications.get(IndicateurReplication::TEMPS_ATTENTE_MOYEN).moyenne;
+        resultat.tempsAttenteMax = static_cast<int>(std::lround(replications.get(IndicateurReplication::TEMPS_ATTENTE_MAX).moyenne));
+        resultat.dureeOperationMoyenne = replications.get(IndicateurReplication::DUREE_OPERATION_MOYENNE).moyenne;
+        resultat.debitPatients = replications.get(IndicateurReplication::DEBIT_PATIENTS).moyenne;
+
+        resultat.tempsAttenteUrgence = replications.get(IndicateurReplication::ATTENTE_URGENCE).moyenne;
+        resultat.tempsAttenteElective = replications.get(IndicateurReplication::ATTENTE_ELECTIVE).moyenne;
+        resultat.tempsAttenteAmbulatoire = replications.get(IndicateurReplication::ATTENTE_AMBULATOIRE).moyenne;
+
+        resultat.nombreUrgences = static_cast<int>(std::lround(replications.get(IndicateurReplication::NOMBRE_URGENCES).moyenne));
+        resultat.nombreElectifs = static_cast<int>(std::lround(replications.get(IndicateurReplication::NOMBRE_ELECTIFS).moyenne));
+        resultat.nombreAmbulatoires = static_cast<int>(std::lround(replications.get(IndicateurReplication::NOMBRE_AMBULATOIRES).moyenne));
+
+        resultat.evenementsParSeconde = replications.dureeSecondes > 0
+            ? replications.nombreEvenements / replications.dureeSecondes : 0.0;
+
+        resultat.tempsDecisionMoyenMicrosecondes = replications.getTempsDecisionMoyenMicrosecondes();
+        resultat.tempsDecisionMaxMicrosecondes = replications.nanosecondesDecisionMax / 1000.0;
+        resultat.depassementsBudget = replications.depassementsBudget;
+
+        return resultat;
+    }
+
+    /**
+     * Compare les algorithmes d'ordonnancement (FCFS, SJF, PRIORITE et
+     * ANTICIPATION par défaut). Avec nombreReplications > 1, chaque algorithme
+     * est évalué sur les mêmes réplications (mêmes flux aléatoires) en parallèle.
+     * Le temps de chaque décision est mesuré.
+     */
+    void comparerAlgorithmes(const ConfigSimulation& configBase, size_t nombreReplications = 1,
+                             const std::vector<AlgorithmeOrdonnancement>& algorithmes = {
+                                 AlgorithmeOrdonnancement::FCFS,
+                                 AlgorithmeOrdonnancement::SJF,
+                                 AlgorithmeOrdonnancement::PRIORITE,
+                                 AlgorithmeOrdonnancement::ANTICIPATION
+                             }) {
         // Sauvegarder la config pour l'export
         this->configBase = configBase;
         
-        std::vector<AlgorithmeOrdonnancement> algorithmes = {
-            AlgorithmeOrdonnancement::FCFS,
-            AlgorithmeOrdonnancement::SJF,
-            AlgorithmeOrdonnancement::PRIORITE
-        };
-        
         std::cout << "\n";
         std::cout << "╔═══════════════════════════════════════════════════════════════╗\n";
         std::cout << "║     BENCHMARK - COMPARAISON DES ALGORITHMES D'ORDONNANCEMENT  ║\n";
@@ -128,6 +181,12 @@ public:
             ConfigSimulation config = configBase;
             config.algorithme = algo;
             config.nom = "Test " + algorithmeToString(algo);
+            config.mesurerDecisions = true;
+            
+            if (nombreReplications > 1) {
+                resultats.push_back(executerReplications(config, nombreReplications));
+                continue;
+            }
             
             ResultatSimulation resultat = executerSimulation(config);
             resultats.push_back(resultat);
@@ -148,21 +207,21 @@ public:
         
         // En-tête du tableau
         std::cout << std::left;
-        std::cout << "┌─────────────┬──────────┬──────────┬──────────┬──────────┬──────────┐\n";
-        std::cout << "│ " << std::setw(11) << "Algorithme"
+        std::cout << "┌────────────────┬──────────┬──────────┬──────────┬──────────┬──────────┐\n";
+        std::cout << "│ " << std::setw(14) << "Algorithme"
                   << " │ " << std::setw(8) << "Patients"
                   << " │ " << std::setw(8) << "Traités"
                   << " │ " << std::setw(8) << "Attente"
                   << " │ " << std::setw(8) << "Max"
                   << " │ " << std::setw(8) << "Débit" << " │\n";
-        std::cout << "│             │  Total   │    (%)   │   moy.   │  (min)   │  (pat/h) │\n";
-        std::cout << "├─────────────┼──────────┼──────────┼──────────┼──────────┼──────────┤\n";
+        std::cout << "│                │  Total   │    (%)   │   moy.   │  (min)   │  (pat/h) │\n";
+        std::cout << "├────────────────┼──────────┼──────────┼──────────┼──────────┼──────────┤\n";
         
         for (const auto& r : resultats) {
             double tauxTraitement = r.nombrePatientsTotal > 0 ? 
                 (static_cast<double>(r.nombrePatientsTraites) / r.nombrePatientsTotal * 100.0) : 0.0;
             
-            std::cout << "│ " << std::setw(11) << r.nomAlgorithme
+            std::cout << "│ " << std::setw(14) << r.nomAlgorithme
                       << " │ " << std::setw(8) << r.nombrePatientsTotal
                       << " │ " << std::setw(7) << std::fixed << std::setprecision(1) << tauxTraitement << "%"
                       << " │ " << std::setw(7) << std::fixed << std::setprecision(1) << r.tempsAttenteMoyen << "m"
@@ -170,28 +229,86 @@ public:
                       << " │ " << std::setw(7) << std::fixed << std::setprecision(2) << r.debitPatients << " │\n";
         }
         
-        std::cout << "└─────────────┴──────────┴──────────┴──────────┴──────────┴──────────┘\n\n";
+        std::cout << "└────────────────┴──────────┴──────────┴──────────┴──────────┴──────────┘\n\n";
         
         // Tableau détaillé par priorité
         std::cout << "╔══════════════════════════════════════════════════════════════════════════╗\n";
         std::cout << "║              📋 TEMPS D'ATTENTE MOYEN PAR PRIORITÉ (minutes)             ║\n";
         std::cout << "╚══════════════════════════════════════════════════════════════════════════╝\n\n";
         
-        std::cout << "┌─────────────┬──────────────────┬──────────────────┬──────────────────┐\n";
-        std::cout << "│ " << std::setw(11) << "Algorithme"
+        std::cout << "┌────────────────┬──────────────────┬──────────────────┬──────────────────┐\n";
+        std::cout << "│ " << std::setw(14) << "Algorithme"
                   << " │ " << std::setw(16) << "🚨 Urgences"
                   << " │ " << std::setw(16) << "📅 Électifs"
                   << " │ " << std::setw(16) << "🚶 Ambulatoire" << " │\n";
-        std::cout << "├─────────────┼──────────────────┼──────────────────┼──────────────────┤\n";
+        std::cout << "├────────────────┼──────────────────┼──────────────────┼──────────────────┤\n";
         
         for (const auto& r : resultats) {
-            std::cout << "│ " << std::setw(11) << r.nomAlgorithme
+            std::cout << "│ " << std::setw(14) << r.nomAlgorithme
                       << " │ " << std::setw(15) << std::fixed << std::setprecision(1) << r.tempsAttenteUrgence << "m"
                       << " │ " << std::setw(15) << std::fixed << std::setprecision(1) << r.tempsAttenteElective << "m"
                       << " │ " << std::setw(15) << std::fixed << std::setprecision(1) << r.tempsAttenteAmbulatoire << "m │\n";
         }
         
-        std::cout << "└─────────────┴──────────────────┴──────────────────┴──────────────────┘\n";
+        std::cout << "└────────────────┴──────────────────┴──────────────────┴──────────────────┘\n";
+        
+        // Vitesse du moteur par politique (mode réplications)
+        if (!resultats.empty() && resultats.front().evenementsParSeconde > 0) {
+            std::cout << "\n⚡ Vitesse du moteur (millions d'événements/s):\n";
+            for (const auto& r : resultats) {
+                std::cout << "   • " << std::setw(15) << r.nomAlgorithme
+                          << std::fixed << std::setprecision(2) << r.evenementsParSeconde / 1e6 << "\n";
+            }
+        }
+        
+        afficherTempsDecision();
+    }
+    
+    /**
+     * Score de référence: meilleur score parmi FCFS, SJF et PRIORITE (0 si absents)
+     */
+    double getScoreReference() const {
+        double reference = 0.0;
+        for (const auto& r : resultats) {
+            if (r.algorithme != AlgorithmeOrdonnancement::FCFS && r.algorithme != AlgorithmeOrdonnancement::SJF
+                && r.algorithme != AlgorithmeOrdonnancement::PRIORITE) continue;
+            if (reference == 0.0 || r.calculerScore() < reference) reference = r.calculerScore();
+        }
+        return reference;
+    }
+    
+    /**
+     * Temps de décision et qualité (score) par rapport à la meilleure politique simple
+     */
+    void afficherTempsDecision() {
+        double reference = getScoreReference();
+        
+        std::cout << "\n🧮 Temps de décision et qualité (score: plus bas = meilleur";
+        if (reference > 0) std::cout << ", écart au meilleur de FCFS/SJF/PRIORITE";
+        std::cout << "):\n";
+        std::cout << "┌────────────────┬──────────┬──────────┬──────────┬──────────┬──────────┐\n";
+        std::cout << "│ " << std::setw(14) << "Algorithme"
+                  << " │ " << std::setw(8) << "Score"
+                  << " │ " << std::setw(9) << "Écart"
+                  << " │ " << std::setw(8) << "Moy."
+                  << " │ " << std::setw(8) << "Max"
+                  << " │ " << std::setw(8) << "Budget" << " │\n";
+        std::cout << "│                │          │   (%)    │   (µs)   │   (µs)   │ dépassé  │\n";
+        std::cout << "├────────────────┼──────────┼──────────┼──────────┼──────────┼──────────┤\n";
+        
+        for (const auto& r : resultats) {
+            std::ostringstream ecart;
+            ecart << std::showpos << std::fixed << std::setprecision(1)
+                  << (reference > 0 ? (r.calculerScore() - reference) / reference * 100.0 : 0.0) << "%";
+            std::cout << "│ " << std::setw(14) << r.nomAlgorithme
+                      << " │ " << std::setw(8) << std::fixed << std::setprecision(1) << r.calculerScore()
+                      << " │ " << std::setw(8) << ecart.str()
+                      << " │ " << std::setw(8) << std::setprecision(2) << r.tempsDecisionMoyenMicrosecondes
+                      << " │ " << std::setw(8) << r.tempsDecisionMaxMicrosecondes
+                      << " │ " << std::setw(8) << r.depassementsBudget << " │\n";
+        }
+        
+        std::cout << "└────────────────┴──────────┴──────────┴──────────┴──────────┴──────────┘\n";
     }
     
     /**
@@ -267,6 +384,18 @@ public:
                 std::cout << "     • Priorise les urgences médicales\n";
                 std::cout << "     • Temps d'attente minimal pour cas critiques\n";
                 std::cout << "     • Conforme aux protocoles médicaux\n";
+            } else if (r.nomAlgorithme == "EDF") {
+                std::cout << "     • Respecte les délais cibles de chaque priorité\n";
+                std::cout << "     • Un électif ancien finit par passer avant une urgence récente\n";
+            } else if (r.nomAlgorithme == "WSJF") {
+                std::cout << "     • Débit élevé tout en favorisant les urgences\n";
+                std::cout << "     • Urgence courte servie en premier\n";
+            } else if (r.nomAlgorithme == "VIEILLISSEMENT") {
+                std::cout << "     • Priorités médicales respectées à court terme\n";
+                std::cout << "     • Pas de famine: l'attente fait monter la priorité\n";
+            } else if (r.nomAlgorithme == "ANTICIPATION") {
+                std::cout << "     • Tient compte des électifs programmés dans l'horizon\n";
+                std::cout << "     • Décide pour tous les blocs libres à la fois\n";
             }
             
             // Faiblesses
@@ -283,6 +412,18 @@ public:
                 std::cout << "     • Temps d'attente plus long pour électifs\n";
                 std::cout << "     • Peut créer de la frustration chez patients non-urgents\n";
                 std::cout << "     • Débit global potentiellement réduit\n";
+            } else if (r.nomAlgorithme == "EDF") {
+                std::cout << "     • Délais cibles à calibrer par service\n";
+                std::cout << "     • Ignore la durée des opérations\n";
+            } else if (r.nomAlgorithme == "WSJF") {
+                std::cout << "     • Opérations longues non urgentes retardées\n";
+                std::cout << "     • Poids des priorités arbitraires\n";
+            } else if (r.nomAlgorithme == "VIEILLISSEMENT") {
+                std::cout << "     • Une urgence peut attendre derrière un électif très ancien\n";
+                std::cout << "     • Période de vieillissement à calibrer\n";
+            } else if (r.nomAlgorithme == "ANTICIPATION") {
+                std::cout << "     • Décision plus coûteuse (bornée par le budget de temps)\n";
+                std::cout << "     • Les urgences futures restent imprévisibles\n";
             }
             
             // Cas d'usage recommandé
@@ -299,6 +440,14 @@ public:
                 std::cout << "     • ⭐ Hôpitaux avec service d'urgences actif\n";
                 std::cout << "     • Environnement mixte urgences/électifs\n";
                 std::cout << "     • Respect strict des protocoles médicaux\n";
+            } else if (r.nomAlgorithme == "EDF") {
+                std::cout << "     • Services avec engagements de délai par catégorie\n";
+            } else if (r.nomAlgorithme == "WSJF") {
+                std::cout << "     • Forte charge, objectif de débit pondéré\n";
+            } else if (r.nomAlgorithme == "VIEILLISSEMENT") {
+                std::cout << "     • Priorités strictes avec garantie contre la famine\n";
+            } else if (r.nomAlgorithme == "ANTICIPATION") {
+                std::cout << "     • Programme opératoire chargé et connu à l'avance\n";
             }
             
             std::cout << "\n";
@@ -340,6 +489,12 @@ public:
                 {"tempsAttenteMax", r.tempsAttenteMax},
                 {"dureeOperationMoyenne", r.dureeOperationMoyenne},
                 {"debitPatients", r.debitPatients},
+                {"evenementsParSeconde", r.evenementsParSeconde},
+                {"decisions", {
+                    {"tempsMoyenMicrosecondes", r.tempsDecisionMoyenMicrosecondes},
+                    {"tempsMaxMicrosecondes", r.tempsDecisionMaxMicrosecondes},
+                    {"depassementsBudget", r.depassementsBudget}
+                }},
                 {"parPriorite", {
                     {"urgences", {
                         {"nombre", r.nombreUrgences},
@@ -452,6 +607,18 @@ public:
                << " | " << std::fixed << std::setprecision(1) << r.tempsAttenteAmbulatoire << " min |\n";
         }
         
+        md << "\n## 🧮 Temps de Décision\n\n";
+        md << "| Algorithme | Score | Décision moy. | Décision max | Dépassements du budget |\n";
+        md << "|------------|-------|---------------|--------------|------------------------|\n";
+        
+        for (const auto& r : resultats) {
+            md << "| " << r.nomAlgorithme
+               << " | " << std::fixed << std::setprecision(1) << r.calculerScore()
+               << " | " << std::setprecision(2) << r.tempsDecisionMoyenMicrosecondes << " µs"
+               << " | " << r.tempsDecisionMaxMicrosecondes << " µs"
+               << " | " << r.depassementsBudget << " |\n";
+        }
+        
         md << "\n## 🏆 Recommandation\n\n";
         md << "Pour un environnement hospitalier avec urgences: **PRIORITY**\n\n";
         md << "Pour optimisation du débit: **SJF** (avec gestion urgences séparée)\n";
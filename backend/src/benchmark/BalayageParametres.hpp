@@ -0,0 +1,391 @@
+#ifndef BALAYAGE_PARAMETRES_HPP
+#define BALAYAGE_PARAMETRES_HPP
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <iomanip>
+#include <chrono>
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <stdexcept>
+#include <nlohmann/json.hpp>
+#include "PoolTravail.hpp"
+#include "EcrivainColonnes.hpp"
+#include "ExecuteurReplications.hpp"
+#include "../simulation/SimulationEngine.hpp"
+#include "../simulation/FluxAleatoire.hpp"
+#include "../enums/PlanExperience.hpp"
+#include "../enums/AlgorithmeOrdonnancement.hpp"
+
+using json = nlohmann::json;
+using namespace AutoMed;
+
+/**
+ * Champs de ConfigSimulation qu'un balayage peut faire varier
+ */
+enum class ParametreBalayage {
+    NOMBRE_BLOCS = 0,
+    NOMBRE_EQUIPES,
+    CAPACITE_SALLE_ATTENTE,
+    CAPACITE_SALLE_REVEIL,
+    TAUX_URGENCES,
+    PATIENTS_ELECTIFS,
+    ALGORITHME,
+    EQUIPES_SPECIALISEES,
+    NOMBRE_PARAMETRES
+};
+
+static const size_t NOMBRE_PARAMETRES_BALAYAGE =
+    static_cast<size_t>(ParametreBalayage::NOMBRE_PARAMETRES);
+
+inline std::string parametreBalayageToString(ParametreBalayage parametre) {
+    switch (parametre) {
+        case ParametreBalayage::NOMBRE_BLOCS: return "nombreBlocs";
+        case ParametreBalayage::NOMBRE_EQUIPES: return "nombreEquipes";
+        case ParametreBalayage::CAPACITE_SALLE_ATTENTE: return "capaciteSalleAttente";
+        case ParametreBalayage::CAPACITE_SALLE_REVEIL: return "capaciteSalleReveil";
+        case ParametreBalayage::TAUX_URGENCES: return "tauxArriveeHoraireUrgences";
+        case ParametreBalayage::PATIENTS_ELECTIFS: return "nombrePatientsElectifs";
+        case ParametreBalayage::ALGORITHME: return "algorithme";
+        case ParametreBalayage::EQUIPES_SPECIALISEES: return "nombreEquipesSpecialisees";
+        default: return "INCONNU";
+    }
+}
+
+inline ParametreBalayage stringToParametreBalayage(const std::string& str) {
+    for (size_t p = 0; p < NOMBRE_PARAMETRES_BALAYAGE; p++) {
+        if (parametreBalayageToString(static_cast<ParametreBalayage>(p)) == str) {
+            return static_cast<ParametreBalayage>(p);
+        }
+    }
+    throw std::invalid_argument("Paramètre de balayage inconnu: " + str);
+}
+
+/**
+ * Domaine d'un paramètre balayé
+ * Plan factoriel: on parcourt valeurs. Hypercube latin: tirage continu dans
+ * [minimum, maximum] si continu, sinon tirage d'un indice dans valeurs.
+ */
+struct PlageParametre {
+    ParametreBalayage parametre;
+    std::vector<double> valeurs;
+    double minimum = 0.0;
+    double maximum = 0.0;
+    bool continu = false;
+};
+
+/**
+ * Résumé d'un balayage
+ */
+struct ResultatBalayage {
+    PlanExperience plan;
+    size_t nombrePoints = 0;
+    size_t nombreSimulations = 0;
+    size_t nombreThreads = 0;
+    uint64_t nombreEvenements = 0;
+    uint64_t lignesEcrites = 0;
+    double dureeSecondes = 0.0;
+
+    double getSimulationsParSeconde() const {
+        return dureeSecondes > 0 ? nombreSimulations / dureeSecondes : 0.0;
+    }
+};
+
+/**
+ * Balayage de paramètres / plan d'expériences pour le dimensionnement
+ *
+ * Chaque point du plan est une ConfigSimulation dérivée de la configuration
+ * de base; chaque point est répliqué replicationsParPoint fois avec
+ * identifiantFlux = numéro de réplication (mêmes flux aléatoires pour tous
+ * les points: les écarts entre points ne viennent que des paramètres).
+ * Les simulations tournent sur le pool de travail, chaque travailleur
+ * réutilisant son moteur; les lignes partent en flux vers un fichier AMCOL.
+ */
+class BalayageParametres {
+private:
+    ConfigSimulation configBase;
+    PlanExperience plan;
+    std::vector<PlageParametre> plages;
+    size_t nombrePointsHypercube;
+    size_t replicationsParPoint;
+    size_t nombreThreads;
+    uint64_t graineHypercube;
+
+    static bool estEntier(ParametreBalayage parametre) {
+        return parametre != ParametreBalayage::TAUX_URGENCES;
+    }
+
+    /**
+     * Valeur prise dans la tranche donnée (hypercube latin)
+     */
+    static double valeurHypercube(const PlageParametre& plage, double position) {
+        if (!plage.continu) {
+            size_t indice = std::min(plage.valeurs.size() - 1,
+                                     static_cast<size_t>(position * plage.valeurs.size()));
+            return plage.valeurs[indice];
+        }
+        if (estEntier(plage.parametre)) {
+            double valeur = std::floor(plage.minimum + position * (plage.maximum - plage.minimum + 1.0));
+            return std::min(valeur, plage.maximum);
+        }
+        return plage.minimum + position * (plage.maximum - plage.minimum);
+    }
+
+public:
+    /**
+     * Constructeur
+     */
+    explicit BalayageParametres(const ConfigSimulation& configBase,
+                                PlanExperience plan = PlanExperience::FACTORIEL_COMPLET)
+        : configBase(configBase),
+          plan(plan),
+          nombrePointsHypercube(100),
+          replicationsParPoint(1),
+          nombreThreads(0),
+          graineHypercube(configBase.graine) {}
+
+    /**
+     * Ajoute un intervalle [minimum, maximum] parcouru par pas
+     */
+    void ajouterIntervalle(ParametreBalayage parametre, double minimum, double maximum, double pas = 1.0) {
+        PlageParametre plage;
+        plage.parametre = parametre;
+        plage.minimum = minimum;
+        plage.maximum = maximum;
+        plage.continu = true;
+        if (pas <= 0.0) pas = 1.0;
+        for (double v = minimum; v <= maximum + 1e-9; v += pas) {
+            plage.valeurs.push_back(v);
+        }
+        plages.push_back(plage);
+    }
+
+    /**
+     * Ajoute une liste explicite de valeurs
+     */
+    void ajouterValeurs(ParametreBalayage parametre, const std::vector<double>& valeurs) {
+        if (valeurs.empty()) return;
+        PlageParametre plage;
+        plage.parametre = parametre;
+        plage.valeurs = valeurs;
+        plage.minimum = *std::min_element(valeurs.begin(), valeurs.end());
+        plage.maximum = *std::max_element(valeurs.begin(), valeurs.end());
+        plage.continu = false;
+        plages.push_back(plage);
+    }
+
+    void setNombrePointsHypercube(size_t nombre) { nombrePointsHypercube = std::max<size_t>(1, nombre); }
+    void setReplicationsParPoint(size_t nombre) { replicationsParPoint = std::max<size_t>(1, nombre); }
+    void setNombreThreads(size_t nombre) { nombreThreads = nombre; }
+    void setGraineHypercube(uint64_t graine) { graineHypercube = graine; }
+
+    /**
+     * Applique la valeur d'un paramètre à une configuration
+     */
+    static void appliquer(ConfigSimulation& config, ParametreBalayage parametre, double valeur) {
+        switch (parametre) {
+            case ParametreBalayage::NOMBRE_BLOCS: config.nombreBlocs = static_cast<int>(std::lround(valeur)); break;
+            case ParametreBalayage::NOMBRE_EQUIPES: config.nombreEquipes = static_cast<int>(std::lround(valeur)); break;
+            case ParametreBalayage::CAPACITE_SALLE_ATTENTE: config.capaciteSalleAttente = static_cast<int>(std::lround(valeur)); break;
+            case ParametreBalayage::CAPACITE_SALLE_REVEIL: config.capaciteSalleReveil = static_cast<int>(std::lround(valeur)); break;
+            case ParametreBalayage::TAUX_URGENCES: config.tauxArriveeHoraireUrgences = valeur; break;
+            case ParametreBalayage::PATIENTS_ELECTIFS: config.nombrePatientsElectifs = static_cast<int>(std::lround(valeur)); break;
+            case ParametreBalayage::ALGORITHME: config.algorithme = static_cast<AlgorithmeOrdonnancement>(std::lround(valeur)); break;
+            case ParametreBalayage::EQUIPES_SPECIALISEES: config.nombreEquipesSpecialisees = static_cast<int>(std::lround(valeur)); break;
+            default: break;
+        }
+    }
+
+    /**
+     * Valeurs de tous les paramètres d'une configuration (colonnes du fichier)
+     */
+    static std::vector<double> valeursParametres(const ConfigSimulation& config) {
+        return {
+            static_cast<double>(config.nombreBlocs),
+            static_cast<double>(config.nombreEquipes),
+            static_cast<double>(config.capaciteSalleAttente),
+            static_cast<double>(config.capaciteSalleReveil),
+            config.tauxArriveeHoraireUrgences,
+            static_cast<double>(config.nombrePatientsElectifs),
+            static_cast<double>(static_cast<int>(config.algorithme)),
+            static_cast<double>(config.nombreEquipesSpecialisees)
+        };
+    }
+
+    /**
+     * Génère les points du plan: une ligne par point, une valeur par plage
+     */
+    std::vector<std::vector<double>> genererPoints() const {
+        std::vector<std::vector<double>> points;
+
+        if (plan == PlanExperience::FACTORIEL_COMPLET) {
+            size_t total = 1;
+            for (const auto& plage : plages) total *= plage.valeurs.size();
+            points.reserve(total);
+
+            // Compteur mixte: le dernier paramètre varie le plus vite
+            std::vector<size_t> indices(plages.size(), 0);
+            for (size_t n = 0; n < total; n++) {
+                std::vector<double> point(plages.size());
+                for (size_t p = 0; p < plages.size(); p++) {
+                    point[p] = plages[p].valeurs[indices[p]];
+                }
+                points.push_back(point);
+
+                for (size_t p = plages.size(); p-- > 0;) {
+                    if (++indices[p] < plages[p].valeurs.size()) break;
+                    indices[p] = 0;
+                }
+            }
+            return points;
+        }
+
+        // Hypercube latin: une permutation des tranches par paramètre
+        size_t n = nombrePointsHypercube;
+        points.assign(n, std::vector<double>(plages.size()));
+        FluxAleatoire flux(graineHypercube, 0, SourceAleatoire::PLAN_EXPERIENCE);
+
+        std::vector<size_t> tranches(n);
+        for (size_t p = 0; p < plages.size(); p++) {
+            for (size_t i = 0; i < n; i++) tranches[i] = i;
+            for (size_t i = n; i > 1; i--) {
+                size_t j = static_cast<size_t>(flux.uniforme01() * i);
+                std::swap(tranches[i - 1], tranches[j]);
+            }
+            for (size_t i = 0; i < n; i++) {
+                double position = (tranches[i] + flux.uniforme01()) / n;
+                points[i][p] = valeurHypercube(plages[p], position);
+            }
+        }
+        return points;
+    }
+
+    /**
+     * Exécute le plan et écrit une ligne par simulation dans fichierSortie
+     */
+    ResultatBalayage executer(const std::string& fichierSortie) {
+        std::vector<std::vector<double>> points = genererPoints();
+
+        std::vector<std::string> colonnes = {"point", "replication"};
+        for (size_t p = 0; p < NOMBRE_PARAMETRES_BALAYAGE; p++) {
+            colonnes.push_back(parametreBalayageToString(static_cast<ParametreBalayage>(p)));
+        }
+        for (size_t k = 0; k < NOMBRE_INDICATEURS_REPLICATION; k++) {
+            colonnes.push_back(indicateurReplicationToString(static_cast<IndicateurReplication>(k)));
+        }
+        colonnes.push_back("nombreEvenements");
+
+        json metadonnees = {
+            {"plan", planExperienceToString(plan)},
+            {"graine", configBase.graine},
+            {"dureeSimulationMinutes", configBase.dureeSimulationMinutes},
+            {"replicationsParPoint", replicationsParPoint},
+            {"nombrePoints", points.size()}
+        };
+        EcrivainColonnes ecrivain(fichierSortie, colonnes, metadonnees);
+
+        PoolTravail pool(nombreThreads);
+        std::vector<SimulationEngine*> moteurs(pool.getNombreThreads(), nullptr);
+        std::atomic<uint64_t> evenements(0);
+
+        ResultatBalayage resultat;
+        resultat.plan = plan;
+        resultat.nombrePoints = points.size();
+        resultat.nombreSimulations = points.size() * replicationsParPoint;
+        resultat.nombreThreads = pool.getNombreThreads();
+
+        auto debut = std::chrono::steady_clock::now();
+
+        pool.paralleliser(resultat.nombreSimulations, [&](size_t indice, size_t travailleur) {
+            size_t point = indice / replicationsParPoint;
+            size_t replication = indice % replicationsParPoint;
+
+            ConfigSimulation config = configBase;
+            for (size_t p = 0; p < plages.size(); p++) {
+                appliquer(config, plages[p].parametre, points[point][p]);
+            }
+            config.identifiantFlux = configBase.identifiantFlux + replication;
+            config.facteurVitesse = 0.0;
+            config.niveauJournal = NiveauJournal::AUCUN;
+
+            SimulationEngine*& engine = moteurs[travailleur];
+            if (engine) {
+                engine->reinitialiser(static_cast<int>(indice + 1), config);
+            } else {
+                engine = new SimulationEngine(static_cast<int>(indice + 1), config);
+            }
+            engine->demarrer();
+
+            std::vector<double> ligne = {static_cast<double>(point), static_cast<double>(replication)};
+            for (double v : valeursParametres(config)) ligne.push_back(v);
+            for (double v : ExecuteurReplications::mesurer(*engine)) ligne.push_back(v);
+            ligne.push_back(static_cast<double>(engine->getNombreEvenementsTraites()));
+            ecrivain.ajouterLigne(ligne);
+
+            evenements.fetch_add(engine->getNombreEvenementsTraites());
+        });
+
+        for (auto* engine : moteurs) delete engine;
+        ecrivain.fermer();
+
+        resultat.dureeSecondes = std::chrono::duration<double>(std::chrono::steady_clock::now() - debut).count();
+        resultat.nombreEvenements = evenements.load();
+        resultat.lignesEcrites = ecrivain.getLignesEcrites();
+        return resultat;
+    }
+
+    /**
+     * Affiche le résumé d'un balayage
+     */
+    static void afficher(const ResultatBalayage& resultat, const std::string& fichierSortie) {
+        std::cout << "\n📐 Plan " << planExperienceToString(resultat.plan) << ": "
+                  << resultat.nombrePoints << " points, " << resultat.nombreSimulations << " simulations sur "
+                  << resultat.nombreThreads << " thread(s)\n";
+        std::cout << "   ⏱️  " << std::fixed << std::setprecision(3) << resultat.dureeSecondes << " s  ("
+                  << std::setprecision(1) << resultat.getSimulationsParSeconde() << " simulations/s, "
+                  << std::setprecision(2) << (resultat.dureeSecondes > 0 ? resultat.nombreEvenements / resultat.dureeSecondes / 1e6 : 0.0)
+                  << " M évt/s)\n";
+        std::cout << "✅ " << resultat.lignesEcrites << " lignes écrites dans: " << fichierSortie << "\n";
+    }
+
+    /**
+     * Construit un balayage depuis sa description JSON:
+     * {"plan": "HYPERCUBE_LATIN", "points": 1000, "replications": 3, "threads": 0,
+     *  "parametres": {"nombreBlocs": {"min": 1, "max": 8, "pas": 1},
+     *                 "algorithme": ["FCFS", "SJF"], "tauxArriveeHoraireUrgences": [2, 4, 6]}}
+     */
+    static BalayageParametres depuisJson(const json& description, const ConfigSimulation& configBase) {
+        PlanExperience plan = stringToPlanExperience(description.value("plan", std::string("FACTORIEL_COMPLET")));
+        BalayageParametres balayage(configBase, plan);
+        balayage.setNombrePointsHypercube(description.value("points", static_cast<size_t>(100)));
+        balayage.setReplicationsParPoint(description.value("replications", static_cast<size_t>(1)));
+        balayage.setNombreThreads(description.value("threads", static_cast<size_t>(0)));
+        balayage.setGraineHypercube(description.value("graine", configBase.graine));
+
+        if (!description.contains("parametres")) return balayage;
+
+        for (auto& [nom, domaine] : description["parametres"].items()) {
+            ParametreBalayage parametre = stringToParametreBalayage(nom);
+
+            if (domaine.is_array()) {
+                std::vector<double> valeurs;
+                for (const auto& v : domaine) {
+                    valeurs.push_back(v.is_string()
+                        ? static_cast<double>(static_cast<int>(stringToAlgorithme(v.get<std::string>())))
+                        : v.get<double>());
+                }
+                balayage.ajouterValeurs(parametre, valeurs);
+            } else if (domaine.is_object()) {
+                balayage.ajouterIntervalle(parametre, domaine.at("min").get<double>(),
+                                           domaine.at("max").get<double>(), domaine.value("pas", 1.0));
+            } else {
+                balayage.ajouterValeurs(parametre, {domaine.get<double>()});
+            }
+        }
+        return balayage;
+    }
+};
+
+#endif // BALAYAGE_PARAMETRES_HPP
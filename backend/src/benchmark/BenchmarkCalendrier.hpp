@@ -0,0 +1,272 @@
+#ifndef BENCHMARK_CALENDRIER_HPP
+#define BENCHMARK_CALENDRIER_HPP
+
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <string>
+#include <iomanip>
+#include <chrono>
+#include <random>
+#include <nlohmann/json.hpp>
+#include "../simulation/CalendrierEvenements.hpp"
+#include "../simulation/SimulationEngine.hpp"
+#include "../enums/ModeCalendrier.hpp"
+
+using json = nlohmann::json;
+using namespace AutoMed;
+
+/**
+ * Résultat d'une passe du benchmark calendrier
+ */
+struct ResultatCalendrier {
+    ModeCalendrier mode;
+    uint64_t nombreEvenements;
+    uint64_t nombreReplanifications;    // Événements en attente déplacés par poignée
+    double dureeSecondes;
+    uint64_t empreinte;     // Empreinte de l'ordre d'extraction (doit être identique entre modes)
+
+    double getEvenementsParSeconde() const {
+        return dureeSecondes > 0 ? nombreEvenements / dureeSecondes : 0.0;
+    }
+};
+
+/**
+ * Compare les structures du calendrier d'événements (modèle "hold")
+ *
+ * Une population fixe d'événements en attente: chaque extraction est suivie
+ * d'une planification à un délai tiré des horizons typiques du simulateur
+ * (arrivées d'urgence, opérations, nettoyage, réveil). En option, un
+ * événement en attente sur periodeReplanification est déplacé par sa poignée
+ * (fin d'opération repoussée, arrivée avancée...).
+ */
+class BenchmarkCalendrier {
+private:
+    std::vector<ResultatCalendrier> resultats;
+    size_t population;
+    std::vector<int> delaisMinutes;       // Délais pré-tirés (hors chronométrage)
+    std::vector<TypeEvenement> typesDelais;
+
+    /**
+     * Pré-tire les délais pour ne mesurer que le calendrier
+     */
+    void preparerDelais(size_t nombre) {
+        std::mt19937_64 rng(12345);
+        std::uniform_real_distribution<> uniform01(0.0, 1.0);
+        std::exponential_distribution<> arrivees(1.0 / 30.0);   // Une urgence toutes les 30 min en moyenne
+        std::uniform_int_distribution<> operations(45, 390);
+
+        delaisMinutes.resize(nombre);
+        typesDelais.resize(nombre);
+        for (size_t i = 0; i < nombre; i++) {
+            double tirage = uniform01(rng);
+            if (tirage < 0.40) {
+                delaisMinutes[i] = std::max(1, static_cast<int>(arrivees(rng)));
+                typesDelais[i] = TypeEvenement::ARRIVEE_PATIENT;
+            } else if (tirage < 0.65) {
+                delaisMinutes[i] = operations(rng);
+                typesDelais[i] = TypeEvenement::FIN_OPERATION;
+            } else if (tirage < 0.85) {
+                delaisMinutes[i] = 15;
+                typesDelais[i] = TypeEvenement::FIN_NETTOYAGE_BLOC;
+            } else {
+                delaisMinutes[i] = 60;
+                typesDelais[i] = TypeEvenement::SORTIE_SALLE_REVEIL;
+            }
+        }
+    }
+
+public:
+    /**
+     * Constructeur
+     */
+    explicit BenchmarkCalendrier(size_t population = 10000)
+        : population(population) {
+        preparerDelais(1 << 20);
+    }
+
+    /**
+     * Exécute une passe: nombreEvenements extractions/replanifications, et un
+     * déplacement par poignée toutes les periodeReplanification extractions (0: aucun)
+     */
+    ResultatCalendrier executer(ModeCalendrier mode, uint64_t nombreEvenements,
+                                uint64_t periodeReplanification = 0) {
+        const time_t origine = 1700000000;
+        const size_t masque = delaisMinutes.size() - 1;
+
+        CalendrierEvenements calendrier(mode);
+        calendrier.setOrigine(origine);
+        calendrier.reserver(population + 1);
+
+        // Un événement en attente par identifiant: sa poignée courante
+        std::vector<PoigneeEvenement> poignees(population);
+        size_t curseur = 0;
+        for (size_t i = 0; i < population; i++) {
+            poignees[i] = calendrier.planifier(typesDelais[curseur], origine + delaisMinutes[curseur] * 60, static_cast<int>(i));
+            curseur = (curseur + 1) & masque;
+        }
+
+        uint64_t empreinte = 1469598103934665603ULL;
+        uint64_t replanifications = 0;
+        auto debut = std::chrono::steady_clock::now();
+
+        for (uint64_t n = 0; n < nombreEvenements; n++) {
+            EvenementPlanifie evt = calendrier.extraire();
+            empreinte = (empreinte ^ evt.sequence) * 1099511628211ULL;
+
+            poignees[evt.patientId] = calendrier.planifier(
+                typesDelais[curseur], evt.horodatage + delaisMinutes[curseur] * 60, evt.patientId);
+            curseur = (curseur + 1) & masque;
+
+            if (periodeReplanification > 0 && n % periodeReplanification == 0) {
+                size_t cible = curseur % population;
+                poignees[cible] = calendrier.replanifier(poignees[cible], evt.horodatage + delaisMinutes[curseur] * 60);
+                curseur = (curseur + 1) & masque;
+                replanifications++;
+            }
+        }
+
+        auto fin = std::chrono::steady_clock::now();
+
+        ResultatCalendrier resultat;
+        resultat.mode = mode;
+        resultat.nombreEvenements = nombreEvenements;
+        resultat.nombreReplanifications = replanifications;
+        resultat.dureeSecondes = std::chrono::duration<double>(fin - debut).count();
+        resultat.empreinte = empreinte;
+        return resultat;
+    }
+
+    /**
+     * Compare les deux modes de 10^6 jusqu'à nombreMax événements, puis sur
+     * 10^6 événements avec un déplacement par poignée toutes les 4 extractions
+     */
+    void comparer(uint64_t nombreMax) {
+        std::cout << "\n";
+        std::cout << "╔═══════════════════════════════════════════════════════════════╗\n";
+        std::cout << "║     BENCHMARK - CALENDRIER D'ÉVÉNEMENTS (TAS vs ROUE)         ║\n";
+        std::cout << "╚═══════════════════════════════════════════════════════════════╝\n";
+        std::cout << "\n📊 Population d'événements en attente: " << population << "\n\n";
+
+        for (uint64_t nombre = 1000000; nombre <= nombreMax; nombre *= 10) {
+            resultats.push_back(executer(ModeCalendrier::TAS_BINAIRE, nombre));
+            resultats.push_back(executer(ModeCalendrier::ROUE_TEMPORELLE, nombre));
+        }
+        resultats.push_back(executer(ModeCalendrier::TAS_BINAIRE, 1000000, 4));
+        resultats.push_back(executer(ModeCalendrier::ROUE_TEMPORELLE, 1000000, 4));
+    }
+
+    /**
+     * Affiche un tableau comparatif dans la console
+     * Retourne false si les deux modes divergent sur l'ordre d'extraction
+     */
+    bool afficherTableau() const {
+        bool identiques = true;
+
+        std::cout << std::left;
+        std::cout << "┌─────────────┬─────────────────┬──────────┬──────────┬────────────┬─────────┬──────────┐\n";
+        std::cout << "│ " << std::setw(11) << "Événements"
+                  << " │ " << std::setw(15) << "Mode"
+                  << " │ " << std::setw(8) << "Replanif"
+                  << " │ " << std::setw(8) << "Durée(s)"
+                  << " │ " << std::setw(10) << "M évt/s"
+                  << " │ " << std::setw(7) << "Gain"
+                  << " │ " << std::setw(8) << "Ordre" << " │\n";
+        std::cout << "├─────────────┼─────────────────┼──────────┼──────────┼────────────┼─────────┼──────────┤\n";
+
+        for (size_t i = 0; i + 1 < resultats.size(); i += 2) {
+            const ResultatCalendrier& tas = resultats[i];
+            const ResultatCalendrier& roue = resultats[i + 1];
+            bool memeOrdre = tas.empreinte == roue.empreinte;
+            identiques = identiques && memeOrdre;
+
+            for (const ResultatCalendrier* r : {&tas, &roue}) {
+                double gain = r->dureeSecondes > 0 ? tas.dureeSecondes / r->dureeSecondes : 0.0;
+                std::cout << "│ " << std::setw(11) << r->nombreEvenements
+                          << " │ " << std::setw(15) << modeCalendrierToString(r->mode)
+                          << " │ " << std::setw(8) << r->nombreReplanifications
+                          << " │ " << std::setw(8) << std::fixed << std::setprecision(3) << r->dureeSecondes
+                          << " │ " << std::setw(10) << std::fixed << std::setprecision(2) << r->getEvenementsParSeconde() / 1e6
+                          << " │ " << std::right << std::setw(6) << std::fixed << std::setprecision(2) << gain << "x" << std::left
+                          << " │ " << std::setw(8) << (memeOrdre ? "✓" : "✗") << " │\n";
+            }
+        }
+
+        std::cout << "└─────────────┴─────────────────┴──────────┴──────────┴────────────┴─────────┴──────────┘\n";
+        std::cout << (identiques ? "\n✅ Ordre d'extraction identique entre les deux modes\n"
+                                 : "\n❌ Divergence de l'ordre d'extraction entre les modes\n");
+        return identiques;
+    }
+
+    /**
+     * Vérifie sur le moteur complet que les deux modes donnent des statistiques
+     * identiques au bit près pour une même graine, sans puis avec préemption
+     * des urgences (annulations par poignée)
+     */
+    bool verifierMoteur(const ConfigSimulation& configBase) const {
+        bool identiques = true;
+
+        for (bool preemption : {false, true}) {
+            std::string reference;
+            for (ModeCalendrier mode : {ModeCalendrier::TAS_BINAIRE, ModeCalendrier::ROUE_TEMPORELLE}) {
+                ConfigSimulation config = configBase;
+                config.modeCalendrier = mode;
+                config.preemptionUrgences = preemption;
+
+                SimulationEngine engine(1, config);
+                engine.demarrer();
+                std::string statistiques = engine.getStatistiques().dump();
+
+                const auto calendrier = engine.getEtatActuel()["calendrier"];
+                std::cout << "   " << std::left << std::setw(15) << modeCalendrierToString(mode)
+                          << (preemption ? " préemption" : "           ")
+                          << " | annulés: " << calendrier["evenementsAnnules"]
+                          << " | périmés: " << calendrier["evenementsPerimes"]
+                          << " | compactages: " << calendrier["compactages"]
+                          << " | pool: " << calendrier["taillePool"] << "\n";
+
+                if (reference.empty()) {
+                    reference = statistiques;
+                } else if (statistiques != reference) {
+                    identiques = false;
+                }
+            }
+        }
+
+        std::cout << (identiques ? "\n✅ Moteur: statistiques identiques entre TAS_BINAIRE et ROUE_TEMPORELLE\n"
+                                 : "\n❌ Moteur: statistiques différentes entre TAS_BINAIRE et ROUE_TEMPORELLE\n");
+        return identiques;
+    }
+
+    /**
+     * Exporte les résultats en JSON
+     */
+    void exporterJSON(const std::string& fichier) const {
+        json j;
+        j["benchmark"] = {
+            {"type", "calendrier"},
+            {"timestamp", std::time(nullptr)},
+            {"population", population}
+        };
+
+        json resultatsJson = json::array();
+        for (const auto& r : resultats) {
+            resultatsJson.push_back({
+                {"mode", modeCalendrierToString(r.mode)},
+                {"nombreEvenements", r.nombreEvenements},
+                {"nombreReplanifications", r.nombreReplanifications},
+                {"dureeSecondes", r.dureeSecondes},
+                {"evenementsParSeconde", r.getEvenementsParSeconde()},
+                {"empreinte", r.empreinte}
+            });
+        }
+        j["resultats"] = resultatsJson;
+
+        std::ofstream file(fichier);
+        file << std::setw(4) << j << std::endl;
+
+        std::cout << "✅ Résultats exportés vers: " << fichier << "\n";
+    }
+};
+
+#endif // BENCHMARK_CALENDRIER_HPP
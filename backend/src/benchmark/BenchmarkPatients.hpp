@@ -0,0 +1,223 @@
+#ifndef BENCHMARK_PATIENTS_HPP
+#define BENCHMARK_PATIENTS_HPP
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <iomanip>
+#include <chrono>
+#include <nlohmann/json.hpp>
+#include "../models/Patient.hpp"
+#include "../simulation/SimulationEngine.hpp"
+
+using json = nlohmann::json;
+using namespace AutoMed;
+
+/**
+ * Mesures de l'enregistrement patient
+ */
+struct ResultatPatients {
+    size_t taillePatient = 0;               // sizeof(Patient)
+    size_t octetsRegistreParPatient = 0;    // Colonnes du registre, par patient
+    double octetsAreneParPatient = 0.0;     // Arène d'une simulation / patients créés
+    size_t nombrePatients = 0;              // Patients créés par simulation
+    size_t nombreSimulations = 0;
+    uint64_t nombreEvenements = 0;
+    double dureeSimulationsSecondes = 0.0;
+    uint64_t nombreNomsJournal = 0;         // Noms écrits comme dans une trace
+    double dureeNomsAllouesSecondes = 0.0;  // getNomComplet(): une chaîne par ligne
+    double dureeNomsFluxSecondes = 0.0;     // nomComplet(): écriture directe dans le flux
+    double microsecondesRequeteStats = 0.0; // Statistics::toJson() en fin de simulation
+    bool statistiquesCoherentes = false;    // Accumulateurs en flux == passe sur le registre
+
+    double getPatientsParSeconde() const {
+        return dureeSimulationsSecondes > 0 ? nombrePatients * nombreSimulations / dureeSimulationsSecondes : 0.0;
+    }
+
+    double getEvenementsParSeconde() const {
+        return dureeSimulationsSecondes > 0 ? nombreEvenements / dureeSimulationsSecondes : 0.0;
+    }
+
+    double getNanosecondesParNom(double dureeSecondes) const {
+        return nombreNomsJournal > 0 ? dureeSecondes * 1e9 / nombreNomsJournal : 0.0;
+    }
+};
+
+/**
+ * Coût mémoire et débit de l'enregistrement patient
+ *
+ * Un mois simulé à forte charge, répété sur le même moteur: taille d'un
+ * patient, octets d'arène par patient, patients et événements par seconde.
+ * Puis le nom complet de chaque patient est écrit dans un flux comme le
+ * ferait une trace, avec et sans chaîne intermédiaire. Enfin les
+ * accumulateurs en flux de Statistics sont comparés à une passe complète sur
+ * les colonnes du registre, et le coût d'une requête toJson() est mesuré.
+ */
+class BenchmarkPatients {
+private:
+    ResultatPatients resultat;
+
+    static ConfigSimulation configMensuelle() {
+        ConfigSimulation config;
+        config.nom = "Mois à forte charge";
+        config.facteurVitesse = 0.0;
+        config.niveauJournal = NiveauJournal::AUCUN;
+        config.dureeSimulationMinutes = 30 * 24 * 60;
+        config.nombreBlocs = 8;
+        config.nombreEquipes = 8;
+        config.capaciteSalleAttente = 1000;
+        config.capaciteSalleReveil = 200;
+        config.tauxArriveeHoraireUrgences = 6.0;
+        config.nombrePatientsElectifs = 200;
+        return config;
+    }
+
+public:
+    /**
+     * Exécute les mesures (nombreSimulations répétitions du mois simulé)
+     */
+    const ResultatPatients& mesurer(size_t nombreSimulations) {
+        resultat = ResultatPatients();
+        resultat.taillePatient = sizeof(Patient);
+        resultat.octetsRegistreParPatient = RegistrePatients::OCTETS_PAR_PATIENT;
+        resultat.nombreSimulations = std::max<size_t>(1, nombreSimulations);
+
+        ConfigSimulation config = configMensuelle();
+        SimulationEngine engine(1, config);
+
+        auto debut = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < resultat.nombreSimulations; i++) {
+            if (i > 0) engine.reinitialiser(1, config);
+            engine.demarrer();
+            resultat.nombreEvenements += engine.getNombreEvenementsTraites();
+        }
+        resultat.dureeSimulationsSecondes =
+            std::chrono::duration<double>(std::chrono::steady_clock::now() - debut).count();
+
+        const RegistrePatients& registre = engine.getRegistre();
+        resultat.nombrePatients = registre.getNombrePatients();
+        if (resultat.nombrePatients > 0) {
+            resultat.octetsAreneParPatient =
+                static_cast<double>(engine.getOctetsArene()) / resultat.nombrePatients;
+        }
+
+        // Accumulateurs en flux contre recalcul exact sur les colonnes
+        const Statistics& stats = engine.getStats();
+        RegistrePatients::Synthese synthese = registre.calculerSynthese();
+        resultat.statistiquesCoherentes =
+            stats.getTempsAttente().getNombre() == static_cast<uint64_t>(synthese.attente.nombre)
+            && stats.getTempsAttenteMoyen() == synthese.attente.getMoyenne()
+            && stats.getTempsAttenteMax() == synthese.attente.max
+            && stats.getDureeOperationMoyenne() == synthese.dureeOperation.getMoyenne()
+            && stats.getTempsSejourMoyen() == synthese.sejour.getMoyenne();
+        for (PrioritePatient priorite : {PrioritePatient::URGENCE, PrioritePatient::ELECTIVE, PrioritePatient::AMBULATOIRE}) {
+            resultat.statistiquesCoherentes = resultat.statistiquesCoherentes
+                && stats.getTempsAttenteMoyenPriorite(priorite) == synthese.getAttente(priorite).getMoyenne();
+        }
+
+        const size_t requetes = 1000;
+        size_t tailleJson = 0;
+        debut = std::chrono::steady_clock::now();
+        for (size_t r = 0; r < requetes; r++) {
+            tailleJson += stats.toJson().size();
+        }
+        resultat.microsecondesRequeteStats =
+            std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - debut).count() / requetes;
+        if (tailleJson == 0) resultat.microsecondesRequeteStats = 0.0;
+
+        // Noms complets écrits dans un flux, comme une ligne de trace
+        const size_t passes = 200;
+        std::ostringstream flux;
+        size_t longueur = 0;
+
+        debut = std::chrono::steady_clock::now();
+        for (size_t p = 0; p < passes; p++) {
+            flux.str(std::string());
+            for (size_t id = 1; id <= resultat.nombrePatients; id++) {
+                flux << "    → " << registre.trouver(static_cast<int>(id))->getNomComplet() << " | ";
+            }
+            longueur += static_cast<size_t>(flux.tellp());
+        }
+        resultat.dureeNomsAllouesSecondes =
+            std::chrono::duration<double>(std::chrono::steady_clock::now() - debut).count();
+
+        debut = std::chrono::steady_clock::now();
+        for (size_t p = 0; p < passes; p++) {
+            flux.str(std::string());
+            for (size_t id = 1; id <= resultat.nombrePatients; id++) {
+                flux << "    → " << registre.trouver(static_cast<int>(id))->nomComplet() << " | ";
+            }
+            longueur -= static_cast<size_t>(flux.tellp());
+        }
+        resultat.dureeNomsFluxSecondes =
+            std::chrono::duration<double>(std::chrono::steady_clock::now() - debut).count();
+        resultat.nombreNomsJournal = passes * resultat.nombrePatients;
+
+        if (longueur != 0) {
+            std::cout << "❌ Les deux écritures du nom complet diffèrent\n";
+        }
+        return resultat;
+    }
+
+    /**
+     * Affiche les mesures dans la console
+     */
+    void afficher() const {
+        std::cout << "\n🧍 Enregistrement patient - " << resultat.nombreSimulations << " × "
+                  << resultat.nombrePatients << " patients (mois à forte charge)\n";
+        std::cout << "   sizeof(Patient):          " << resultat.taillePatient << " octets\n";
+        std::cout << "   Registre (colonnes):      " << resultat.octetsRegistreParPatient << " octets/patient\n";
+        std::cout << "   Arène de la simulation:   " << std::fixed << std::setprecision(1)
+                  << resultat.octetsAreneParPatient << " octets/patient\n";
+        std::cout << "   Débit:                    " << std::setprecision(0) << resultat.getPatientsParSeconde()
+                  << " patients/s, " << std::setprecision(2) << resultat.getEvenementsParSeconde() / 1e6
+                  << " M évt/s\n";
+        std::cout << "   Nom complet (trace):      " << std::setprecision(1)
+                  << resultat.getNanosecondesParNom(resultat.dureeNomsAllouesSecondes) << " ns avec chaîne, "
+                  << resultat.getNanosecondesParNom(resultat.dureeNomsFluxSecondes) << " ns en flux\n";
+        std::cout << "   Requête statistiques:     " << resultat.microsecondesRequeteStats << " µs ("
+                  << (resultat.statistiquesCoherentes ? "✅ identiques à la passe sur le registre"
+                                                      : "❌ différentes de la passe sur le registre")
+                  << ")\n";
+    }
+
+    /**
+     * Exporte les mesures en JSON
+     */
+    void exporterJSON(const std::string& fichier) const {
+        json j;
+        j["benchmark"] = {
+            {"type", "patients"},
+            {"timestamp", std::time(nullptr)},
+            {"nombreSimulations", resultat.nombreSimulations},
+            {"nombrePatients", resultat.nombrePatients}
+        };
+        j["memoire"] = {
+            {"taillePatient", resultat.taillePatient},
+            {"octetsRegistreParPatient", resultat.octetsRegistreParPatient},
+            {"octetsAreneParPatient", resultat.octetsAreneParPatient}
+        };
+        j["debit"] = {
+            {"dureeSecondes", resultat.dureeSimulationsSecondes},
+            {"patientsParSeconde", resultat.getPatientsParSeconde()},
+            {"evenementsParSeconde", resultat.getEvenementsParSeconde()}
+        };
+        j["nomComplet"] = {
+            {"nombre", resultat.nombreNomsJournal},
+            {"nanosecondesAvecChaine", resultat.getNanosecondesParNom(resultat.dureeNomsAllouesSecondes)},
+            {"nanosecondesEnFlux", resultat.getNanosecondesParNom(resultat.dureeNomsFluxSecondes)}
+        };
+        j["statistiques"] = {
+            {"microsecondesRequete", resultat.microsecondesRequeteStats},
+            {"coherentes", resultat.statistiquesCoherentes}
+        };
+
+        std::ofstream file(fichier);
+        file << std::setw(4) << j << std::endl;
+
+        std::cout << "✅ Résultats exportés vers: " << fichier << "\n";
+    }
+};
+
+#endif // BENCHMARK_PATIENTS_HPP
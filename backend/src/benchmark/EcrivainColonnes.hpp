@@ -0,0 +1,111 @@
+#ifndef ECRIVAIN_COLONNES_HPP
+#define ECRIVAIN_COLONNES_HPP
+
+#include <cstdint>
+#include <fstream>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <nlohmann/json.hpp>
+
+namespace AutoMed {
+
+/**
+ * Écriture en flux d'un fichier colonnaire (format AMCOL)
+ *
+ *   "AMCOL1\n"
+ *   en-tête JSON sur une ligne: {"colonnes": [...], "tailleGroupe": N, ...}
+ *   groupes de lignes: uint32 nombreLignes, puis pour chaque colonne
+ *                      nombreLignes valeurs double (little-endian)
+ *
+ * Les lignes sont accumulées par groupe puis écrites colonne par colonne:
+ * le fichier se lit une colonne à la fois et peut être consommé pendant
+ * que le balayage tourne. Thread-safe.
+ */
+class EcrivainColonnes {
+private:
+    std::ofstream fichier;
+    std::vector<std::vector<double>> colonnes;  // Groupe en cours, une colonne par vecteur
+    size_t tailleGroupe;
+    size_t lignesEnAttente;
+    uint64_t lignesEcrites;
+    std::mutex mutex;
+
+    void ecrireGroupe() {
+        if (lignesEnAttente == 0) return;
+
+        uint32_t nombre = static_cast<uint32_t>(lignesEnAttente);
+        fichier.write(reinterpret_cast<const char*>(&nombre), sizeof(nombre));
+        for (auto& colonne : colonnes) {
+            fichier.write(reinterpret_cast<const char*>(colonne.data()),
+                          static_cast<std::streamsize>(colonne.size() * sizeof(double)));
+            colonne.clear();
+        }
+        fichier.flush();
+
+        lignesEcrites += lignesEnAttente;
+        lignesEnAttente = 0;
+    }
+
+public:
+    /**
+     * Ouvre le fichier et écrit l'en-tête (métadonnées libres fusionnées)
+     */
+    EcrivainColonnes(const std::string& chemin, const std::vector<std::string>& nomsColonnes,
+                     const nlohmann::json& metadonnees = nlohmann::json::object(),
+                     size_t tailleGroupe = 1024)
+        : fichier(chemin, std::ios::binary | std::ios::trunc),
+          colonnes(nomsColonnes.size()),
+          tailleGroupe(tailleGroupe > 0 ? tailleGroupe : 1),
+          lignesEnAttente(0),
+          lignesEcrites(0) {
+        if (!fichier) {
+            throw std::runtime_error("Impossible d'ouvrir " + chemin);
+        }
+
+        nlohmann::json entete = metadonnees;
+        entete["colonnes"] = nomsColonnes;
+        entete["tailleGroupe"] = this->tailleGroupe;
+
+        fichier << "AMCOL1\n" << entete.dump() << "\n";
+        for (auto& colonne : colonnes) colonne.reserve(this->tailleGroupe);
+    }
+
+    ~EcrivainColonnes() {
+        fermer();
+    }
+
+    EcrivainColonnes(const EcrivainColonnes&) = delete;
+    EcrivainColonnes& operator=(const EcrivainColonnes&) = delete;
+
+    /**
+     * Ajoute une ligne (autant de valeurs que de colonnes)
+     */
+    void ajouterLigne(const std::vector<double>& ligne) {
+        std::lock_guard<std::mutex> lock(mutex);
+        for (size_t i = 0; i < colonnes.size(); i++) {
+            colonnes[i].push_back(i < ligne.size() ? ligne[i] : 0.0);
+        }
+        if (++lignesEnAttente >= tailleGroupe) {
+            ecrireGroupe();
+        }
+    }
+
+    /**
+     * Écrit le groupe en cours et ferme le fichier
+     */
+    void fermer() {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!fichier.is_open()) return;
+        ecrireGroupe();
+        fichier.close();
+    }
+
+    uint64_t getLignesEcrites() const { return lignesEcrites; }
+    size_t getNombreColonnes() const { return colonnes.size(); }
+};
+
+} // namespace AutoMed
+
+#endif // ECRIVAIN_COLONNES_HPP
@@ -0,0 +1,392 @@
+#ifndef EXECUTEUR_REPLICATIONS_HPP
+#define EXECUTEUR_REPLICATIONS_HPP
+
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <array>
+#include <string>
+#include <iomanip>
+#include <sstream>
+#include <chrono>
+#include <algorithm>
+#include <cmath>
+#include <nlohmann/json.hpp>
+#include "PoolTravail.hpp"
+#include "../simulation/SimulationEngine.hpp"
+#include "../enums/AlgorithmeOrdonnancement.hpp"
+
+using json = nlohmann::json;
+using namespace AutoMed;
+
+/**
+ * Indicateurs collectés pour chaque réplication
+ */
+enum class IndicateurReplication {
+    PATIENTS_TOTAL = 0,
+    PATIENTS_TRAITES,
+    TEMPS_ATTENTE_MOYEN,
+    TEMPS_ATTENTE_MAX,
+    DUREE_OPERATION_MOYENNE,
+    TEMPS_SEJOUR_MOYEN,
+    DEBIT_PATIENTS,
+    ATTENTE_URGENCE,
+    ATTENTE_ELECTIVE,
+    ATTENTE_AMBULATOIRE,
+    NOMBRE_URGENCES,
+    NOMBRE_ELECTIFS,
+    NOMBRE_AMBULATOIRES,
+    BLOCAGE_SPECIALISATION,
+    NOMBRE_INDICATEURS
+};
+
+static const size_t NOMBRE_INDICATEURS_REPLICATION =
+    static_cast<size_t>(IndicateurReplication::NOMBRE_INDICATEURS);
+
+inline std::string indicateurReplicationToString(IndicateurReplication indicateur) {
+    switch (indicateur) {
+        case IndicateurReplication::PATIENTS_TOTAL: return "nombrePatientsTotal";
+        case IndicateurReplication::PATIENTS_TRAITES: return "nombrePatientsTraites";
+        case IndicateurReplication::TEMPS_ATTENTE_MOYEN: return "tempsAttenteMoyen";
+        case IndicateurReplication::TEMPS_ATTENTE_MAX: return "tempsAttenteMax";
+        case IndicateurReplication::DUREE_OPERATION_MOYENNE: return "dureeOperationMoyenne";
+        case IndicateurReplication::TEMPS_SEJOUR_MOYEN: return "tempsSejourMoyen";
+        case IndicateurReplication::DEBIT_PATIENTS: return "debitPatients";
+        case IndicateurReplication::ATTENTE_URGENCE: return "tempsAttenteUrgence";
+        case IndicateurReplication::ATTENTE_ELECTIVE: return "tempsAttenteElective";
+        case IndicateurReplication::ATTENTE_AMBULATOIRE: return "tempsAttenteAmbulatoire";
+        case IndicateurReplication::NOMBRE_URGENCES: return "nombreUrgences";
+        case IndicateurReplication::NOMBRE_ELECTIFS: return "nombreElectifs";
+        case IndicateurReplication::NOMBRE_AMBULATOIRES: return "nombreAmbulatoires";
+        case IndicateurReplication::BLOCAGE_SPECIALISATION: return "blocageSpecialisation";
+        default: return "INCONNU";
+    }
+}
+
+using MesuresReplication = std::array<double, NOMBRE_INDICATEURS_REPLICATION>;
+
+/**
+ * Agrégat d'un indicateur sur l'ensemble des réplications
+ */
+struct IndicateurAgrege {
+    double moyenne = 0.0;
+    double ecartType = 0.0;
+    double demiIntervalle95 = 0.0;  // IC 95%: moyenne ± demiIntervalle95
+    double minimum = 0.0;
+    double p5 = 0.0;
+    double p50 = 0.0;
+    double p95 = 0.0;
+    double maximum = 0.0;
+
+    json toJson() const {
+        return json{
+            {"moyenne", moyenne},
+            {"ecartType", ecartType},
+            {"ic95", {moyenne - demiIntervalle95, moyenne + demiIntervalle95}},
+            {"min", minimum},
+            {"p5", p5},
+            {"p50", p50},
+            {"p95", p95},
+            {"max", maximum}
+        };
+    }
+};
+
+/**
+ * Résultat d'une campagne de réplications
+ */
+struct ResultatReplications {
+    ConfigSimulation config;
+    size_t nombreReplications = 0;
+    size_t nombreThreads = 0;
+    double dureeSecondes = 0.0;
+    uint64_t nombreEvenements = 0;
+    std::vector<MesuresReplication> mesures;                        // Une ligne par réplication
+    std::array<IndicateurAgrege, NOMBRE_INDICATEURS_REPLICATION> agregats;
+
+    // Temps de calcul des décisions, cumulé sur les réplications (dépend de
+    // la machine: gardé hors des mesures, qui doivent être reproductibles)
+    uint64_t nombreDecisions = 0;
+    uint64_t nanosecondesDecisions = 0;
+    uint64_t nanosecondesDecisionMax = 0;
+    uint64_t depassementsBudget = 0;
+
+    const IndicateurAgrege& get(IndicateurReplication indicateur) const {
+        return agregats[static_cast<size_t>(indicateur)];
+    }
+
+    double getReplicationsParSeconde() const {
+        return dureeSecondes > 0 ? nombreReplications / dureeSecondes : 0.0;
+    }
+
+    double getTempsDecisionMoyenMicrosecondes() const {
+        return nombreDecisions > 0 ? nanosecondesDecisions / 1000.0 / nombreDecisions : 0.0;
+    }
+};
+
+/**
+ * Exécuteur de réplications Monte Carlo
+ *
+ * Chaque réplication i rejoue la configuration avec identifiantFlux = i:
+ * même graine, flux aléatoires indépendants, résultat indépendant de
+ * l'ordonnancement des threads. Les réplications sont réparties sur un
+ * pool à vol de tâches; chaque travailleur réutilise son propre moteur et
+ * chaque tâche écrit dans sa propre ligne de résultats (aucun partage, aucun verrou).
+ */
+class ExecuteurReplications {
+private:
+    size_t nombreThreads;
+
+    /**
+     * Quantile de Student à 97,5% (IC 95% bilatéral)
+     */
+    static double quantileStudent(size_t degresLiberte) {
+        static const double table[] = {
+            12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+            2.201, 2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+            2.080, 2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042
+        };
+        if (degresLiberte == 0) return 0.0;
+        if (degresLiberte <= 30) return table[degresLiberte - 1];
+        if (degresLiberte <= 60) return 2.000;
+        if (degresLiberte <= 120) return 1.980;
+        return 1.960;
+    }
+
+    /**
+     * Percentile par interpolation linéaire (valeurs triées)
+     */
+    static double percentile(const std::vector<double>& triees, double p) {
+        if (triees.empty()) return 0.0;
+        double position = p * (triees.size() - 1);
+        size_t bas = static_cast<size_t>(position);
+        size_t haut = std::min(bas + 1, triees.size() - 1);
+        double fraction = position - bas;
+        return triees[bas] + (triees[haut] - triees[bas]) * fraction;
+    }
+
+    static IndicateurAgrege agreger(std::vector<double>& valeurs) {
+        IndicateurAgrege agregat;
+        size_t n = valeurs.size();
+        if (n == 0) return agregat;
+
+        double somme = 0.0;
+        for (double v : valeurs) somme += v;
+        agregat.moyenne = somme / n;
+
+        double sommeCarres = 0.0;
+        for (double v : valeurs) sommeCarres += (v - agregat.moyenne) * (v - agregat.moyenne);
+        agregat.ecartType = n > 1 ? std::sqrt(sommeCarres / (n - 1)) : 0.0;
+        agregat.demiIntervalle95 = n > 1 ? quantileStudent(n - 1) * agregat.ecartType / std::sqrt(static_cast<double>(n)) : 0.0;
+
+        std::sort(valeurs.begin(), valeurs.end());
+        agregat.minimum = valeurs.front();
+        agregat.p5 = percentile(valeurs, 0.05);
+        agregat.p50 = percentile(valeurs, 0.50);
+        agregat.p95 = percentile(valeurs, 0.95);
+        agregat.maximum = valeurs.back();
+        return agregat;
+    }
+
+public:
+    /**
+     * Extrait les indicateurs d'un moteur terminé
+     */
+    static MesuresReplication mesurer(const SimulationEngine& engine) {
+        json stats = engine.getStatistiques();
+        MesuresReplication m;
+        m[static_cast<size_t>(IndicateurReplication::PATIENTS_TOTAL)] = stats["nombrePatientsTotal"];
+        m[static_cast<size_t>(IndicateurReplication::PATIENTS_TRAITES)] = stats["nombrePatientsTraites"];
+        m[static_cast<size_t>(IndicateurReplication::TEMPS_ATTENTE_MOYEN)] = stats["tempsAttenteMoyen"];
+        m[static_cast<size_t>(IndicateurReplication::TEMPS_ATTENTE_MAX)] = stats["tempsAttenteMax"];
+        m[static_cast<size_t>(IndicateurReplication::DUREE_OPERATION_MOYENNE)] = stats["dureeOperationMoyenne"];
+        m[static_cast<size_t>(IndicateurReplication::TEMPS_SEJOUR_MOYEN)] = stats["tempsSejourMoyen"];
+        m[static_cast<size_t>(IndicateurReplication::DEBIT_PATIENTS)] = stats["debitPatients"];
+        m[static_cast<size_t>(IndicateurReplication::ATTENTE_URGENCE)] = stats["parPriorite"]["URGENCE"]["tempsAttenteMoyen"];
+        m[static_cast<size_t>(IndicateurReplication::ATTENTE_ELECTIVE)] = stats["parPriorite"]["ELECTIVE"]["tempsAttenteMoyen"];
+        m[static_cast<size_t>(IndicateurReplication::ATTENTE_AMBULATOIRE)] = stats["parPriorite"]["AMBULATOIRE"]["tempsAttenteMoyen"];
+        m[static_cast<size_t>(IndicateurReplication::NOMBRE_URGENCES)] = stats["parPriorite"]["URGENCE"]["nombre"];
+        m[static_cast<size_t>(IndicateurReplication::NOMBRE_ELECTIFS)] = stats["parPriorite"]["ELECTIVE"]["nombre"];
+        m[static_cast<size_t>(IndicateurReplication::NOMBRE_AMBULATOIRES)] = stats["parPriorite"]["AMBULATOIRE"]["nombre"];
+        m[static_cast<size_t>(IndicateurReplication::BLOCAGE_SPECIALISATION)] = stats["specialisation"]["tempsBlocageMinutes"];
+        return m;
+    }
+
+    /**
+     * Constructeur (0 = un thread par cœur)
+     */
+    explicit ExecuteurReplications(size_t nombreThreads = 0)
+        : nombreThreads(nombreThreads) {}
+
+    /**
+     * Exécute nombreReplications réplications de configBase et agrège les résultats
+     */
+    ResultatReplications executer(const ConfigSimulation& configBase, size_t nombreReplications) {
+        ResultatReplications resultat;
+        resultat.config = configBase;
+        resultat.nombreReplications = nombreReplications;
+        resultat.mesures.resize(nombreReplications);
+
+        std::vector<uint64_t> evenements(nombreReplications, 0);
+        std::vector<std::array<uint64_t, 4>> decisions(nombreReplications);
+        PoolTravail pool(nombreThreads);
+        resultat.nombreThreads = pool.getNombreThreads();
+
+        auto debut = std::chrono::steady_clock::now();
+
+        // Un moteur par travailleur, réinitialisé entre deux réplications
+        std::vector<SimulationEngine*> moteurs(pool.getNombreThreads(), nullptr);
+
+        pool.paralleliser(nombreReplications, [&](size_t indice, size_t travailleur) {
+            ConfigSimulation config = configBase;
+            config.identifiantFlux = configBase.identifiantFlux + indice;
+            config.facteurVitesse = 0.0;
+            config.niveauJournal = NiveauJournal::AUCUN;
+
+            SimulationEngine*& engine = moteurs[travailleur];
+            if (engine) {
+                engine->reinitialiser(static_cast<int>(indice + 1), config);
+            } else {
+                engine = new SimulationEngine(static_cast<int>(indice + 1), config);
+            }
+            engine->demarrer();
+
+            resultat.mesures[indice] = mesurer(*engine);
+            evenements[indice] = engine->getNombreEvenementsTraites();
+            const Statistics& stats = engine->getStats();
+            decisions[indice] = {stats.getNombreDecisions(), stats.getNanosecondesDecisions(),
+                                 stats.getNanosecondesDecisionMax(), stats.getNombreDepassementsBudget()};
+        });
+
+        for (auto* engine : moteurs) delete engine;
+
+        resultat.dureeSecondes = std::chrono::duration<double>(std::chrono::steady_clock::now() - debut).count();
+        for (uint64_t n : evenements) resultat.nombreEvenements += n;
+        for (const auto& d : decisions) {
+            resultat.nombreDecisions += d[0];
+            resultat.nanosecondesDecisions += d[1];
+            resultat.nanosecondesDecisionMax = std::max(resultat.nanosecondesDecisionMax, d[2]);
+            resultat.depassementsBudget += d[3];
+        }
+
+        std::vector<double> colonne(nombreReplications);
+        for (size_t k = 0; k < NOMBRE_INDICATEURS_REPLICATION; k++) {
+            for (size_t i = 0; i < nombreReplications; i++) {
+                colonne[i] = resultat.mesures[i][k];
+            }
+            resultat.agregats[k] = agreger(colonne);
+        }
+        return resultat;
+    }
+
+    /**
+     * Affiche les agrégats dans la console
+     */
+    static void afficher(const ResultatReplications& resultat) {
+        std::cout << "\n📊 " << resultat.config.nom << " - " << algorithmeToString(resultat.config.algorithme)
+                  << " - " << resultat.nombreReplications << " réplications sur "
+                  << resultat.nombreThreads << " thread(s)\n";
+        std::cout << "   ⏱️  " << std::fixed << std::setprecision(3) << resultat.dureeSecondes << " s  ("
+                  << std::setprecision(1) << resultat.getReplicationsParSeconde() << " réplications/s, "
+                  << std::setprecision(2) << (resultat.dureeSecondes > 0 ? resultat.nombreEvenements / resultat.dureeSecondes / 1e6 : 0.0)
+                  << " M évt/s)\n";
+        if (resultat.nombreDecisions > 0) {
+            std::cout << "   🧮 " << resultat.nombreDecisions << " décisions: " << std::setprecision(1)
+                      << resultat.getTempsDecisionMoyenMicrosecondes() << " µs en moyenne, "
+                      << resultat.nanosecondesDecisionMax / 1000.0 << " µs au maximum, "
+                      << resultat.depassementsBudget << " dépassement(s) du budget\n";
+        }
+        std::cout << "\n";
+
+        std::cout << std::left;
+        std::cout << "┌─────────────────────────┬──────────┬──────────────────────┬──────────┬──────────┬──────────┐\n";
+        std::cout << "│ " << std::setw(23) << "Indicateur"
+                  << " │ " << std::setw(8) << "Moyenne"
+                  << " │ " << std::setw(20) << "IC 95%"
+                  << " │ " << std::setw(8) << "P5"
+                  << " │ " << std::setw(8) << "P50"
+                  << " │ " << std::setw(8) << "P95" << " │\n";
+        std::cout << "├─────────────────────────┼──────────┼──────────────────────┼──────────┼──────────┼──────────┤\n";
+
+        for (size_t k = 0; k < NOMBRE_INDICATEURS_REPLICATION; k++) {
+            const IndicateurAgrege& a = resultat.agregats[k];
+            std::ostringstream ic;
+            ic << std::fixed << std::setprecision(2) << "[" << a.moyenne - a.demiIntervalle95
+               << ", " << a.moyenne + a.demiIntervalle95 << "]";
+
+            std::cout << "│ " << std::setw(23) << indicateurReplicationToString(static_cast<IndicateurReplication>(k))
+                      << " │ " << std::setw(8) << std::fixed << std::setprecision(2) << a.moyenne
+                      << " │ " << std::setw(20) << ic.str()
+                      << " │ " << std::setw(8) << a.p5
+                      << " │ " << std::setw(8) << a.p50
+                      << " │ " << std::setw(8) << a.p95 << " │\n";
+        }
+        std::cout << "└─────────────────────────┴──────────┴──────────────────────┴──────────┴──────────┴──────────┘\n";
+    }
+
+    /**
+     * Conversion vers JSON (agrégats + performance)
+     */
+    static json toJson(const ResultatReplications& resultat) {
+        json agregats;
+        for (size_t k = 0; k < NOMBRE_INDICATEURS_REPLICATION; k++) {
+            agregats[indicateurReplicationToString(static_cast<IndicateurReplication>(k))] = resultat.agregats[k].toJson();
+        }
+
+        return json{
+            {"scenario", resultat.config.nom},
+            {"algorithme", algorithmeToString(resultat.config.algorithme)},
+            {"graine", resultat.config.graine},
+            {"nombreReplications", resultat.nombreReplications},
+            {"nombreThreads", resultat.nombreThreads},
+            {"dureeSecondes", resultat.dureeSecondes},
+            {"replicationsParSeconde", resultat.getReplicationsParSeconde()},
+            {"nombreEvenements", resultat.nombreEvenements},
+            {"decisions", {
+                {"nombre", resultat.nombreDecisions},
+                {"tempsMoyenMicrosecondes", resultat.getTempsDecisionMoyenMicrosecondes()},
+                {"tempsMaxMicrosecondes", resultat.nanosecondesDecisionMax / 1000.0},
+                {"depassementsBudget", resultat.depassementsBudget}
+            }},
+            {"indicateurs", agregats}
+        };
+    }
+
+    /**
+     * Mesure le passage à l'échelle: 1 thread puis nombreThreads
+     * Les agrégats doivent être identiques (réplications indépendantes de l'ordonnancement)
+     */
+    static bool mesurerPassageEchelle(const ConfigSimulation& config, size_t nombreReplications,
+                                      size_t nombreThreads, const std::string& fichier) {
+        ResultatReplications sequentiel = ExecuteurReplications(1).executer(config, nombreReplications);
+        ResultatReplications parallele = ExecuteurReplications(nombreThreads).executer(config, nombreReplications);
+
+        afficher(parallele);
+
+        bool identiques = sequentiel.mesures == parallele.mesures;
+        double acceleration = parallele.dureeSecondes > 0 ? sequentiel.dureeSecondes / parallele.dureeSecondes : 0.0;
+
+        std::cout << "\n🚀 Passage à l'échelle: " << std::fixed << std::setprecision(3)
+                  << sequentiel.dureeSecondes << " s (1 thread) → " << parallele.dureeSecondes << " s ("
+                  << parallele.nombreThreads << " threads), accélération " << std::setprecision(2)
+                  << acceleration << "x, efficacité "
+                  << std::setprecision(0) << 100.0 * acceleration / parallele.nombreThreads << "%\n";
+        std::cout << (identiques ? "✅ Résultats identiques en séquentiel et en parallèle\n"
+                                 : "❌ Résultats différents entre séquentiel et parallèle\n");
+
+        json j = toJson(parallele);
+        j["passageEchelle"] = {
+            {"dureeSequentielleSecondes", sequentiel.dureeSecondes},
+            {"acceleration", acceleration},
+            {"resultatsIdentiques", identiques}
+        };
+
+        std::ofstream file(fichier);
+        file << std::setw(4) << j << std::endl;
+        std::cout << "✅ Résultats exportés vers: " << fichier << "\n";
+
+        return identiques;
+    }
+};
+
+#endif // EXECUTEUR_REPLICATIONS_HPP
@@ -0,0 +1,161 @@
+#ifndef POOL_TRAVAIL_HPP
+#define POOL_TRAVAIL_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace AutoMed {
+
+/**
+ * Pool de threads à vol de tâches (work-stealing)
+ *
+ * Chaque travailleur a sa propre file: il consomme ses tâches par la fin
+ * et, une fois sa file vide, vole les tâches des autres par le début.
+ * Les tâches reçoivent l'indice du travailleur qui les exécute, ce qui
+ * permet de garder un état par travailleur (moteur, tampons) sans partage.
+ */
+class PoolTravail {
+public:
+    using Tache = std::function<void(size_t travailleur)>;
+
+private:
+    struct FileTravailleur {
+        std::deque<Tache> taches;
+        std::mutex mutex;
+    };
+
+    std::vector<std::thread> threads;
+    std::vector<FileTravailleur> files;
+    std::atomic<size_t> tachesRestantes;   // Soumises et non terminées
+    std::atomic<size_t> tachesEnFile;      // Soumises et pas encore prises
+    std::atomic<size_t> prochaineFile;
+    std::atomic<bool> arret;
+
+    std::mutex mutexReveil;
+    std::condition_variable reveil;
+    std::condition_variable termine;
+
+    bool prendreTache(size_t travailleur, Tache& tache) {
+        // D'abord sa propre file (par la fin: tâches récentes, caches chauds)
+        {
+            FileTravailleur& file = files[travailleur];
+            std::lock_guard<std::mutex> lock(file.mutex);
+            if (!file.taches.empty()) {
+                tache = std::move(file.taches.back());
+                file.taches.pop_back();
+                tachesEnFile.fetch_sub(1);
+                return true;
+            }
+        }
+
+        // Puis vol chez les autres (par le début)
+        for (size_t i = 1; i < files.size(); i++) {
+            FileTravailleur& victime = files[(travailleur + i) % files.size()];
+            std::lock_guard<std::mutex> lock(victime.mutex);
+            if (!victime.taches.empty()) {
+                tache = std::move(victime.taches.front());
+                victime.taches.pop_front();
+                tachesEnFile.fetch_sub(1);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void boucle(size_t travailleur) {
+        while (true) {
+            Tache tache;
+            if (prendreTache(travailleur, tache)) {
+                tache(travailleur);
+                if (tachesRestantes.fetch_sub(1) == 1) {
+                    std::lock_guard<std::mutex> lock(mutexReveil);
+                    termine.notify_all();
+                }
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock(mutexReveil);
+            if (arret) return;
+            reveil.wait(lock, [this] { return arret || tachesEnFile > 0; });
+            if (arret) return;
+        }
+    }
+
+public:
+    /**
+     * Constructeur (0 = un travailleur par cœur)
+     */
+    explicit PoolTravail(size_t nombreThreads = 0)
+        : files(nombreThreads > 0 ? nombreThreads : std::max(1u, std::thread::hardware_concurrency())),
+          tachesRestantes(0),
+          tachesEnFile(0),
+          prochaineFile(0),
+          arret(false) {
+        for (size_t i = 0; i < files.size(); i++) {
+            threads.emplace_back([this, i] { boucle(i); });
+        }
+    }
+
+    /**
+     * Destructeur - attend la fin des tâches puis arrête les travailleurs
+     */
+    ~PoolTravail() {
+        attendre();
+        {
+            std::lock_guard<std::mutex> lock(mutexReveil);
+            arret = true;
+        }
+        reveil.notify_all();
+        for (auto& thread : threads) {
+            thread.join();
+        }
+    }
+
+    PoolTravail(const PoolTravail&) = delete;
+    PoolTravail& operator=(const PoolTravail&) = delete;
+
+    /**
+     * Soumet une tâche (répartition circulaire entre les files)
+     */
+    void soumettre(Tache tache) {
+        size_t indice = prochaineFile.fetch_add(1) % files.size();
+        tachesRestantes.fetch_add(1);
+        tachesEnFile.fetch_add(1);
+        {
+            std::lock_guard<std::mutex> lock(files[indice].mutex);
+            files[indice].taches.push_back(std::move(tache));
+        }
+        std::lock_guard<std::mutex> lock(mutexReveil);
+        reveil.notify_one();
+    }
+
+    /**
+     * Exécute fonction(indice, travailleur) pour indice dans [0, nombre) et attend la fin
+     */
+    void paralleliser(size_t nombre, const std::function<void(size_t, size_t)>& fonction) {
+        for (size_t indice = 0; indice < nombre; indice++) {
+            soumettre([&fonction, indice](size_t travailleur) { fonction(indice, travailleur); });
+        }
+        attendre();
+    }
+
+    /**
+     * Bloque jusqu'à ce que toutes les tâches soumises soient terminées
+     */
+    void attendre() {
+        std::unique_lock<std::mutex> lock(mutexReveil);
+        termine.wait(lock, [this] { return tachesRestantes == 0; });
+    }
+
+    size_t getNombreThreads() const { return files.size(); }
+};
+
+} // namespace AutoMed
+
+#endif // POOL_TRAVAIL_HPP
@@ -4,9 +4,14 @@
  */
 
 #include <iostream>
+#include <fstream>
 #include <string>
 #include "simulation/SimulationEngine.hpp"
 #include "benchmark/AlgorithmComparison.hpp"
+#include "benchmark/BenchmarkCalendrier.hpp"
+#include "benchmark/BenchmarkPatients.hpp"
+#include "benchmark/ExecuteurReplications.hpp"
+#include "benchmark/BalayageParametres.hpp"
 
 using namespace AutoMed;
 
@@ -156,16 +161,113 @@ ConfigSimulation obtenirConfigScenario(int choix) {
 int main(int argc, char* argv[]) {
     afficherBanniere();
     
-    // Mode non-interactif si arguments fournis
+    // Benchmark du calendrier d'événements: automed_benchmark calendrier [nombreMax]
+    if (argc > 1 && std::string(argv[1]) == "calendrier") {
+        uint64_t nombreMax = (argc > 2) ? std::stoull(argv[2]) : 10000000ULL;
+        
+        BenchmarkCalendrier benchmark;
+        benchmark.comparer(nombreMax);
+        bool identiques = benchmark.afficherTableau();
+        
+        // Même scénario et même graine sur le moteur complet avec les deux modes
+        ConfigSimulation config = obtenirConfigScenario(2);
+        config.dureeSimulationMinutes = 7 * 24 * 60;
+        identiques = benchmark.verifierMoteur(config) && identiques;
+        
+        benchmark.exporterJSON("/app/results/benchmark_calendrier.json");
+        
+        return identiques ? 0 : 1;
+    }
+    
+    // Coût de l'enregistrement patient: automed_benchmark patients [simulations]
+    if (argc > 1 && std::string(argv[1]) == "patients") {
+        size_t nombreSimulations = (argc > 2) ? std::stoul(argv[2]) : 20;
+        
+        BenchmarkPatients benchmark;
+        benchmark.mesurer(nombreSimulations);
+        benchmark.afficher();
+        benchmark.exporterJSON("/app/results/benchmark_patients.json");
+        
+        return 0;
+    }
+    
+    // Réplications Monte Carlo: automed_benchmark replications <scenario> [nombre] [threads]
+    if (argc > 1 && std::string(argv[1]) == "replications") {
+        int scenario = (argc > 2) ? std::stoi(argv[2]) : 1;
+        size_t nombre = (argc > 3) ? std::stoul(argv[3]) : 1000;
+        size_t threads = (argc > 4) ? std::stoul(argv[4]) : 0;
+        
+        ConfigSimulation config = obtenirConfigScenario(scenario >= 1 && scenario <= 4 ? scenario : 1);
+        bool identiques = ExecuteurReplications::mesurerPassageEchelle(
+            config, nombre, threads, "/app/results/benchmark_replications.json");
+        
+        return identiques ? 0 : 1;
+    }
+    
+    // Balayage de paramètres: automed_benchmark balayage [description.json|-] [sortie.amcol]
+    if (argc > 1 && std::string(argv[1]) == "balayage") {
+        std::string sortie = (argc > 3) ? argv[3] : "/app/results/balayage.amcol";
+        
+        try {
+            json description;
+            if (argc > 2 && std::string(argv[2]) != "-") {
+                std::ifstream fichier(argv[2]);
+                if (!fichier) {
+                    std::cerr << "❌ Description introuvable: " << argv[2] << "\n";
+                    return 1;
+                }
+                fichier >> description;
+            } else {
+                // Dimensionnement par défaut: blocs × équipes × λ urgences × algorithme
+                description = {
+                    {"plan", "FACTORIEL_COMPLET"},
+                    {"replications", 3},
+                    {"parametres", {
+                        {"nombreBlocs", {{"min", 1}, {"max", 6}}},
+                        {"nombreEquipes", {{"min", 1}, {"max", 6}}},
+                        {"tauxArriveeHoraireUrgences", {1, 2, 4, 6, 8}},
+                        {"algorithme", {"FCFS", "PRIORITE", "SJF"}}
+                    }}
+                };
+            }
+            
+            ConfigSimulation config = obtenirConfigScenario(description.value("scenario", 1));
+            BalayageParametres balayage = BalayageParametres::depuisJson(description, config);
+            ResultatBalayage resultat = balayage.executer(sortie);
+            BalayageParametres::afficher(resultat, sortie);
+        } catch (const std::exception& e) {
+            std::cerr << "❌ Balayage impossible: " << e.what() << "\n";
+            return 1;
+        }
+        
+        return 0;
+    }
+    
+    // Toutes les politiques en réplications: automed_benchmark politiques <scenario> [réplications]
+    if (argc > 1 && std::string(argv[1]) == "politiques") {
+        int scenario = (argc > 2) ? std::stoi(argv[2]) : 1;
+        size_t nombreReplications = (argc > 3) ? std::stoul(argv[3]) : 200;
+        
+        ConfigSimulation config = obtenirConfigScenario(scenario >= 1 && scenario <= 4 ? scenario : 1);
+        AlgorithmComparison comparison;
+        comparison.comparerAlgorithmes(config, std::max<size_t>(2, nombreReplications), tousLesAlgorithmes());
+        comparison.afficherTableauComparatif();
+        comparison.exporterJSON("/app/results/benchmark_politiques.json");
+        
+        return 0;
+    }
+    
+    // Mode non-interactif si arguments fournis: automed_benchmark <scenario> [réplications]
     if (argc > 1) {
         int scenario = std::stoi(argv[1]);
+        size_t nombreReplications = (argc > 2) ? std::stoul(argv[2]) : 1;
         if (scenario >= 1 && scenario <= 5) {
             std::cout << "\n🚀 Exécution du scénario " << scenario << " (mode non-interactif)\n";
             
             ConfigSimulation config = obtenirConfigScenario(scenario);
             AlgorithmComparison comparison;
             
-            comparison.comparerAlgorithmes(config);
+            comparison.comparerAlgorithmes(config, nombreReplications);
             comparison.afficherTableauComparatif();
             comparison.genererAnalyse();
             
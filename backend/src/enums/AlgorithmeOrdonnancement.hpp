@@ -2,6 +2,7 @@
 #define ALGORITHME_ORDONNANCEMENT_HPP
 
 #include <string>
+#include <vector>
 
 namespace AutoMed {
 
@@ -11,9 +12,28 @@ namespace AutoMed {
 enum class AlgorithmeOrdonnancement {
     FCFS,          // First Come First Serve
     PRIORITE,      // Par priorité (Urgence > Elective > Ambulatoire)
-    SJF            // Shortest Job First
+    SJF,           // Shortest Job First
+    EDF,           // Earliest Deadline First (échéance selon la priorité)
+    WSJF,          // Weighted Shortest Job First (durée / poids de la priorité)
+    VIEILLISSEMENT,// Priorité avec vieillissement (l'attente fait monter la priorité)
+    ANTICIPATION   // Planification par lots sur un horizon (arrivées électives connues)
 };
 
+/**
+ * Tous les algorithmes, dans l'ordre de l'énumération
+ */
+inline std::vector<AlgorithmeOrdonnancement> tousLesAlgorithmes() {
+    return {
+        AlgorithmeOrdonnancement::FCFS,
+        AlgorithmeOrdonnancement::PRIORITE,
+        AlgorithmeOrdonnancement::SJF,
+        AlgorithmeOrdonnancement::EDF,
+        AlgorithmeOrdonnancement::WSJF,
+        AlgorithmeOrdonnancement::VIEILLISSEMENT,
+        AlgorithmeOrdonnancement::ANTICIPATION
+    };
+}
+
 /**
  * Conversion AlgorithmeOrdonnancement vers string
  */
@@ -22,6 +42,10 @@ inline std::string algorithmeToString(AlgorithmeOrdonnancement algo) {
         case AlgorithmeOrdonnancement::FCFS: return "FCFS";
         case AlgorithmeOrdonnancement::PRIORITE: return "PRIORITE";
         case AlgorithmeOrdonnancement::SJF: return "SJF";
+        case AlgorithmeOrdonnancement::EDF: return "EDF";
+        case AlgorithmeOrdonnancement::WSJF: return "WSJF";
+        case AlgorithmeOrdonnancement::VIEILLISSEMENT: return "VIEILLISSEMENT";
+        case AlgorithmeOrdonnancement::ANTICIPATION: return "ANTICIPATION";
         default: return "INCONNU";
     }
 }
@@ -33,6 +57,10 @@ inline AlgorithmeOrdonnancement stringToAlgorithme(const std::string& str) {
     if (str == "FCFS") return AlgorithmeOrdonnancement::FCFS;
     if (str == "PRIORITE") return AlgorithmeOrdonnancement::PRIORITE;
     if (str == "SJF") return AlgorithmeOrdonnancement::SJF;
+    if (str == "EDF") return AlgorithmeOrdonnancement::EDF;
+    if (str == "WSJF") return AlgorithmeOrdonnancement::WSJF;
+    if (str == "VIEILLISSEMENT") return AlgorithmeOrdonnancement::VIEILLISSEMENT;
+    if (str == "ANTICIPATION") return AlgorithmeOrdonnancement::ANTICIPATION;
     return AlgorithmeOrdonnancement::FCFS; // Par défaut
 }
 
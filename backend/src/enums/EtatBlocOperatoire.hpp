@@ -12,7 +12,9 @@ enum class EtatBlocOperatoire {
     LIBRE,          // Disponible pour une opération
     OCCUPE,         // Opération en cours
     NETTOYAGE,      // En cours de nettoyage
-    MAINTENANCE     // En maintenance
+    MAINTENANCE,    // En maintenance
+    RESERVE,        // Patient en préparation, opération pas encore commencée
+    BLOQUE          // Opération terminée, le patient attend un lit de réveil
 };
 
 /**
@@ -24,6 +26,8 @@ inline std::string etatBlocToString(EtatBlocOperatoire etat) {
         case EtatBlocOperatoire::OCCUPE: return "OCCUPE";
         case EtatBlocOperatoire::NETTOYAGE: return "NETTOYAGE";
         case EtatBlocOperatoire::MAINTENANCE: return "MAINTENANCE";
+        case EtatBlocOperatoire::RESERVE: return "RESERVE";
+        case EtatBlocOperatoire::BLOQUE: return "BLOQUE";
         default: return "INCONNU";
     }
 }
@@ -0,0 +1,47 @@
+#ifndef INDICATEUR_SERIE_HPP
+#define INDICATEUR_SERIE_HPP
+
+#include <cstddef>
+#include <string>
+
+namespace AutoMed {
+
+/**
+ * Indicateurs enregistrés à chaque minute virtuelle (séries temporelles)
+ */
+enum class IndicateurSerie {
+    FILE_ATTENTE,           // Patients en salle d'attente
+    BLOCS_OCCUPES,          // Blocs non libres (préparation, opération, nettoyage, réserve)
+    EQUIPES_LIBRES,         // Équipes disponibles
+    OCCUPATION_REVEIL       // Patients en salle de réveil
+};
+
+static const size_t NOMBRE_INDICATEURS_SERIE = 4;
+
+/**
+ * Conversion IndicateurSerie vers string
+ */
+inline std::string indicateurSerieToString(IndicateurSerie indicateur) {
+    switch (indicateur) {
+        case IndicateurSerie::FILE_ATTENTE: return "FILE_ATTENTE";
+        case IndicateurSerie::BLOCS_OCCUPES: return "BLOCS_OCCUPES";
+        case IndicateurSerie::EQUIPES_LIBRES: return "EQUIPES_LIBRES";
+        case IndicateurSerie::OCCUPATION_REVEIL: return "OCCUPATION_REVEIL";
+        default: return "INCONNU";
+    }
+}
+
+/**
+ * Conversion string vers IndicateurSerie
+ */
+inline IndicateurSerie stringToIndicateurSerie(const std::string& str) {
+    if (str == "FILE_ATTENTE") return IndicateurSerie::FILE_ATTENTE;
+    if (str == "BLOCS_OCCUPES") return IndicateurSerie::BLOCS_OCCUPES;
+    if (str == "EQUIPES_LIBRES") return IndicateurSerie::EQUIPES_LIBRES;
+    if (str == "OCCUPATION_REVEIL") return IndicateurSerie::OCCUPATION_REVEIL;
+    return IndicateurSerie::FILE_ATTENTE; // Par défaut
+}
+
+} // namespace AutoMed
+
+#endif // INDICATEUR_SERIE_HPP
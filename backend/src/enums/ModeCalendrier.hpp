@@ -0,0 +1,38 @@
+#ifndef MODE_CALENDRIER_HPP
+#define MODE_CALENDRIER_HPP
+
+#include <string>
+
+namespace AutoMed {
+
+/**
+ * Structure de données utilisée par le calendrier d'événements
+ */
+enum class ModeCalendrier {
+    TAS_BINAIRE,        // Tas binaire de poignées: O(log n) par opération
+    ROUE_TEMPORELLE     // Roue indexée par minute virtuelle: O(1) amorti
+};
+
+/**
+ * Conversion ModeCalendrier vers string
+ */
+inline std::string modeCalendrierToString(ModeCalendrier mode) {
+    switch (mode) {
+        case ModeCalendrier::TAS_BINAIRE: return "TAS_BINAIRE";
+        case ModeCalendrier::ROUE_TEMPORELLE: return "ROUE_TEMPORELLE";
+        default: return "INCONNU";
+    }
+}
+
+/**
+ * Conversion string vers ModeCalendrier
+ */
+inline ModeCalendrier stringToModeCalendrier(const std::string& str) {
+    if (str == "TAS_BINAIRE") return ModeCalendrier::TAS_BINAIRE;
+    if (str == "ROUE_TEMPORELLE") return ModeCalendrier::ROUE_TEMPORELLE;
+    return ModeCalendrier::TAS_BINAIRE; // Par défaut
+}
+
+} // namespace AutoMed
+
+#endif // MODE_CALENDRIER_HPP
@@ -0,0 +1,50 @@
+#ifndef NIVEAU_JOURNAL_HPP
+#define NIVEAU_JOURNAL_HPP
+
+#include <string>
+
+namespace AutoMed {
+
+/**
+ * Niveau de journalisation (du plus bavard au plus silencieux)
+ */
+enum class NiveauJournal {
+    TRACE = 0,          // Chaque événement traité
+    DEBUG = 1,          // Détails internes
+    INFO = 2,           // Cycle de vie des simulations
+    AVERTISSEMENT = 3,
+    ERREUR = 4,
+    AUCUN = 5           // Journal désactivé
+};
+
+/**
+ * Conversion NiveauJournal vers string
+ */
+inline std::string niveauJournalToString(NiveauJournal niveau) {
+    switch (niveau) {
+        case NiveauJournal::TRACE: return "TRACE";
+        case NiveauJournal::DEBUG: return "DEBUG";
+        case NiveauJournal::INFO: return "INFO";
+        case NiveauJournal::AVERTISSEMENT: return "AVERTISSEMENT";
+        case NiveauJournal::ERREUR: return "ERREUR";
+        case NiveauJournal::AUCUN: return "AUCUN";
+        default: return "INCONNU";
+    }
+}
+
+/**
+ * Conversion string vers NiveauJournal
+ */
+inline NiveauJournal stringToNiveauJournal(const std::string& str) {
+    if (str == "TRACE") return NiveauJournal::TRACE;
+    if (str == "DEBUG") return NiveauJournal::DEBUG;
+    if (str == "INFO") return NiveauJournal::INFO;
+    if (str == "AVERTISSEMENT") return NiveauJournal::AVERTISSEMENT;
+    if (str == "ERREUR") return NiveauJournal::ERREUR;
+    if (str == "AUCUN") return NiveauJournal::AUCUN;
+    return NiveauJournal::INFO; // Par défaut
+}
+
+} // namespace AutoMed
+
+#endif // NIVEAU_JOURNAL_HPP
@@ -0,0 +1,38 @@
+#ifndef PLAN_EXPERIENCE_HPP
+#define PLAN_EXPERIENCE_HPP
+
+#include <string>
+
+namespace AutoMed {
+
+/**
+ * Plan d'expériences d'un balayage de paramètres
+ */
+enum class PlanExperience {
+    FACTORIEL_COMPLET,  // Produit cartésien de toutes les valeurs
+    HYPERCUBE_LATIN     // N points, chaque paramètre stratifié en N tranches
+};
+
+/**
+ * Conversion PlanExperience vers string
+ */
+inline std::string planExperienceToString(PlanExperience plan) {
+    switch (plan) {
+        case PlanExperience::FACTORIEL_COMPLET: return "FACTORIEL_COMPLET";
+        case PlanExperience::HYPERCUBE_LATIN: return "HYPERCUBE_LATIN";
+        default: return "INCONNU";
+    }
+}
+
+/**
+ * Conversion string vers PlanExperience
+ */
+inline PlanExperience stringToPlanExperience(const std::string& str) {
+    if (str == "FACTORIEL_COMPLET") return PlanExperience::FACTORIEL_COMPLET;
+    if (str == "HYPERCUBE_LATIN") return PlanExperience::HYPERCUBE_LATIN;
+    return PlanExperience::FACTORIEL_COMPLET; // Par défaut
+}
+
+} // namespace AutoMed
+
+#endif // PLAN_EXPERIENCE_HPP
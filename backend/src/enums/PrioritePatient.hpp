@@ -1,6 +1,7 @@
 #ifndef PRIORITE_PATIENT_HPP
 #define PRIORITE_PATIENT_HPP
 
+#include <cstdint>
 #include <string>
 
 namespace AutoMed {
@@ -8,7 +9,7 @@ namespace AutoMed {
 /**
  * Priorité d'un patient
  */
-enum class PrioritePatient {
+enum class PrioritePatient : uint8_t {
     URGENCE = 1,        // Urgence vitale
     ELECTIVE = 2,       // Opération programmée
     AMBULATOIRE = 3     // Chirurgie ambulatoire (patient rentre le jour même)
@@ -1,6 +1,7 @@
 #ifndef TYPE_OPERATION_HPP
 #define TYPE_OPERATION_HPP
 
+#include <cstdint>
 #include <string>
 
 namespace AutoMed {
@@ -8,7 +9,7 @@ namespace AutoMed {
 /**
  * Types d'opérations chirurgicales
  */
-enum class TypeOperation {
+enum class TypeOperation : uint8_t {
     CARDIAQUE,          // Chirurgie cardiaque
     ORTHOPEDIQUE,       // Chirurgie orthopédique
     NEUROCHIRURGIE,     // Neurochirurgie
@@ -21,6 +22,22 @@ enum class TypeOperation {
     GYNECOLOGIQUE       // Gynécologie
 };
 
+static const size_t NOMBRE_TYPES_OPERATION = 10;
+
+/**
+ * Masque de bits d'un ensemble de types (bit i = TypeOperation i)
+ */
+static const uint32_t TOUS_TYPES_OPERATION = (1u << NOMBRE_TYPES_OPERATION) - 1;
+
+inline uint32_t masqueTypeOperation(TypeOperation type) {
+    return 1u << static_cast<unsigned>(type);
+}
+
+/**
+ * Spécialité d'un chirurgien polyvalent (compatible avec tous les types)
+ */
+static const char* const SPECIALITE_CHIRURGIE_GENERALE = "Chirurgie Générale";
+
 /**
  * Conversion TypeOperation vers string
  */
@@ -40,6 +57,25 @@ inline std::string typeOperationToString(TypeOperation type) {
     }
 }
 
+/**
+ * Spécialité chirurgicale requise pour un type d'opération
+ */
+inline std::string specialiteChirurgicale(TypeOperation type) {
+    switch (type) {
+        case TypeOperation::CARDIAQUE: return "Chirurgie Cardiaque";
+        case TypeOperation::ORTHOPEDIQUE: return "Chirurgie Orthopédique";
+        case TypeOperation::NEUROCHIRURGIE: return "Neurochirurgie";
+        case TypeOperation::DIGESTIVE: return "Chirurgie Digestive";
+        case TypeOperation::THORACIQUE: return "Chirurgie Thoracique";
+        case TypeOperation::VASCULAIRE: return "Chirurgie Vasculaire";
+        case TypeOperation::UROLOGIQUE: return "Urologie";
+        case TypeOperation::ORL: return "ORL";
+        case TypeOperation::OPHTALMOLOGIQUE: return "Ophtalmologie";
+        case TypeOperation::GYNECOLOGIQUE: return "Gynécologie";
+        default: return SPECIALITE_CHIRURGIE_GENERALE;
+    }
+}
+
 } // namespace AutoMed
 
 #endif // TYPE_OPERATION_HPP
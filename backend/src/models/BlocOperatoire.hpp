@@ -2,6 +2,7 @@
 #define BLOC_OPERATOIRE_HPP
 
 #include <string>
+#include <cstdint>
 #include <ctime>
 #include <sstream>
 #include <nlohmann/json.hpp>
@@ -24,6 +25,9 @@ private:
     time_t horodatageDebutOperation;
     time_t horodatageFinOperation;
     int dureeNettoyageMinutes;  // Durée nécessaire pour le nettoyage
+    time_t horodatageDebutBlocage;      // 0 si le bloc n'est pas bloqué
+    int nombreBlocages;                 // Attentes d'un lit de réveil terminées
+    int64_t secondesBlocage;            // Durée cumulée de ces attentes
 
 public:
     /**
@@ -37,7 +41,10 @@ public:
           equipeAssignee(nullptr),
           horodatageDebutOperation(0),
           horodatageFinOperation(0),
-          dureeNettoyageMinutes(dureeNettoyageMinutes) {}
+          dureeNettoyageMinutes(dureeNettoyageMinutes),
+          horodatageDebutBlocage(0),
+          nombreBlocages(0),
+          secondesBlocage(0) {}
 
     /**
      * Destructeur - Ne supprime pas les pointeurs (gestion externe)
@@ -56,6 +63,8 @@ public:
     time_t getHorodatageDebutOperation() const { return horodatageDebutOperation; }
     time_t getHorodatageFinOperation() const { return horodatageFinOperation; }
     int getDureeNettoyageMinutes() const { return dureeNettoyageMinutes; }
+    time_t getHorodatageDebutBlocage() const { return horodatageDebutBlocage; }
+    int getNombreBlocages() const { return nombreBlocages; }
 
     // Setters
     void setNom(const std::string& newNom) { nom = newNom; }
@@ -75,10 +84,76 @@ public:
         return etat == EtatBlocOperatoire::OCCUPE;
     }
 
+    /**
+     * Vérifie si un patient est en préparation (opération pas encore commencée)
+     */
+    bool estReserve() const {
+        return etat == EtatBlocOperatoire::RESERVE;
+    }
+
+    /**
+     * Vérifie si le bloc garde un patient opéré faute de lit de réveil
+     */
+    bool estBloque() const {
+        return etat == EtatBlocOperatoire::BLOQUE;
+    }
+
+    /**
+     * Réserve le bloc pour un patient en préparation: l'équipe est prise,
+     * l'opération commencera à debutPrevu (commencerOperationReservee)
+     */
+    bool reserver(Patient* patient, EquipeMedicale* equipe, time_t debutPrevu) {
+        if (!estDisponible() || !patient || !equipe) {
+            return false;
+        }
+
+        patientActuel = patient;
+        equipeAssignee = equipe;
+        etat = EtatBlocOperatoire::RESERVE;
+        horodatageDebutOperation = debutPrevu;
+        horodatageFinOperation = 0;
+        equipe->reserver();
+        return true;
+    }
+
+    /**
+     * Fin de la préparation: l'opération réservée commence
+     */
+    bool commencerOperationReservee(time_t tempsVirtuel) {
+        if (!estReserve() || !patientActuel) {
+            return false;
+        }
+
+        etat = EtatBlocOperatoire::OCCUPE;
+        horodatageDebutOperation = tempsVirtuel;
+        patientActuel->commencerOperation(tempsVirtuel);
+        return true;
+    }
+
+    /**
+     * Annule la réservation (report du patient): bloc et équipe libérés sans nettoyage
+     * Retourne le patient reporté
+     */
+    Patient* annulerReservation() {
+        if (!estReserve()) {
+            return nullptr;
+        }
+
+        Patient* patient = patientActuel;
+        if (equipeAssignee) {
+            equipeAssignee->liberer();
+            equipeAssignee = nullptr;
+        }
+        patientActuel = nullptr;
+        etat = EtatBlocOperatoire::LIBRE;
+        horodatageDebutOperation = 0;
+        return patient;
+    }
+
     /**
      * Commence une opération avec le temps virtuel
      */
-    bool commencerOperation(Patient* patient, EquipeMedicale* equipe, time_t tempsVirtuel = 0) {
+    bool commencerOperation(Patient* patient, EquipeMedicale* equipe, time_t tempsVirtuel) {
         if (!estDisponible() || !patient || !equipe) {
             return false;
         }
@@ -86,7 +161,7 @@ public:
         patientActuel = patient;
         equipeAssignee = equipe;
         etat = EtatBlocOperatoire::OCCUPE;
-        horodatageDebutOperation = (tempsVirtuel > 0) ? tempsVirtuel : std::time(nullptr);
+        horodatageDebutOperation = tempsVirtuel;
         horodatageFinOperation = 0;
 
         // Marquer le patient comme en opération avec le temps virtuel
@@ -101,12 +176,12 @@ public:
     /**
      * Termine l'opération en cours avec le temps virtuel
      */
-    bool terminerOperation(time_t tempsVirtuel = 0) {
+    bool terminerOperation(time_t tempsVirtuel) {
         if (!estOccupe() || !patientActuel) {
             return false;
         }
 
-        horodatageFinOperation = (tempsVirtuel > 0) ? tempsVirtuel : std::time(nullptr);
+        horodatageFinOperation = tempsVirtuel;
         
         // Marquer le patient comme opération terminée avec le temps virtuel
         patientActuel->terminerOperation(tempsVirtuel);
@@ -117,6 +192,48 @@ public:
         return true;
     }
 
+    /**
+     * Opération terminée sans lit de réveil: le patient reste dans le bloc
+     * (équipe comprise), le nettoyage attend debloquer()
+     */
+    bool bloquer(time_t tempsVirtuel) {
+        if (etat != EtatBlocOperatoire::NETTOYAGE || !patientActuel) {
+            return false;
+        }
+
+        etat = EtatBlocOperatoire::BLOQUE;
+        horodatageDebutBlocage = tempsVirtuel;
+        return true;
+    }
+
+    /**
+     * Un lit de réveil s'est libéré: le patient sort, le nettoyage commence
+     * Retourne la durée du blocage en secondes (-1 si le bloc n'était pas bloqué)
+     */
+    int64_t debloquer(time_t tempsVirtuel) {
+        if (!estBloque()) {
+            return -1;
+        }
+
+        int64_t duree = static_cast<int64_t>(tempsVirtuel - horodatageDebutBlocage);
+        secondesBlocage += duree;
+        nombreBlocages++;
+        horodatageDebutBlocage = 0;
+        etat = EtatBlocOperatoire::NETTOYAGE;
+        return duree;
+    }
+
+    /**
+     * Temps bloqué cumulé en minutes, blocage en cours compris
+     */
+    double getTempsBlocageMinutes(time_t maintenant) const {
+        int64_t secondes = secondesBlocage;
+        if (estBloque() && maintenant > horodatageDebutBlocage) {
+            secondes += static_cast<int64_t>(maintenant - horodatageDebutBlocage);
+        }
+        return secondes / 60.0;
+    }
+
     /**
      * Termine le nettoyage et libère le bloc
      */
@@ -152,13 +269,13 @@ public:
     }
 
     /**
-     * Calcule la durée de l'opération en cours en minutes
+     * Calcule la durée de l'opération en cours en minutes (à l'instant maintenant)
      */
-    int getDureeOperationEnCoursMinutes() const {
+    int getDureeOperationEnCoursMinutes(time_t maintenant) const {
         if (!estOccupe() || horodatageDebutOperation == 0) {
             return 0;
         }
-        return static_cast<int>(std::difftime(std::time(nullptr), horodatageDebutOperation) / 60);
+        return static_cast<int>(std::difftime(maintenant, horodatageDebutOperation) / 60);
     }
 
     /**
@@ -174,37 +291,41 @@ public:
     /**
      * Conversion vers JSON pour l'API
      */
-    nlohmann::json toJson() const {
+    nlohmann::json toJson(time_t maintenant) const {
         return nlohmann::json{
             {"id", id},
             {"nom", nom},
             {"etat", etatBlocToString(etat)},
-            {"patientActuel", patientActuel ? patientActuel->toJson() : nullptr},
+            {"patientActuel", patientActuel ? patientActuel->toJson(maintenant) : nullptr},
             {"equipeAssignee", equipeAssignee ? equipeAssignee->toJson() : nullptr},
             {"horodatageDebutOperation", horodatageDebutOperation},
             {"horodatageFinOperation", horodatageFinOperation},
             {"dureeNettoyageMinutes", dureeNettoyageMinutes},
-            {"dureeOperationEnCoursMinutes", getDureeOperationEnCoursMinutes()},
+            {"dureeOperationEnCoursMinutes", getDureeOperationEnCoursMinutes(maintenant)},
             {"dureeDerniereOperationMinutes", getDureeDerniereOperationMinutes()},
+            {"horodatageDebutBlocage", horodatageDebutBlocage},
+            {"nombreBlocages", nombreBlocages},
+            {"tempsBlocageMinutes", getTempsBlocageMinutes(maintenant)},
             {"estDisponible", estDisponible()},
-            {"estOccupe", estOccupe()}
+            {"estOccupe", estOccupe()},
+            {"estBloque", estBloque()}
         };
     }
 
     /**
      * Conversion vers string pour debug
      */
-    std::string toString() const {
+    std::string toString(time_t maintenant) const {
         std::ostringstream oss;
         oss << "Bloc #" << id << ": " << nom
             << " | État: " << etatBlocToString(etat);
         
         if (patientActuel) {
-            oss << " | Patient: " << patientActuel->getNomComplet();
+            oss << " | Patient: " << patientActuel->nomComplet();
         }
         
         if (estOccupe()) {
-            oss << " | Durée: " << getDureeOperationEnCoursMinutes() << "min";
+            oss << " | Durée: " << getDureeOperationEnCoursMinutes(maintenant) << "min";
         }
 
         return oss.str();
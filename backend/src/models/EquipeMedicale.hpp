@@ -4,6 +4,7 @@
 #include <string>
 #include <vector>
 #include <nlohmann/json.hpp>
+#include "../enums/TypeOperation.hpp"
 
 namespace AutoMed {
 
@@ -116,6 +117,27 @@ public:
                !infirmiers.empty();
     }
 
+    /**
+     * Types d'opération que l'équipe peut prendre en charge (masque de bits),
+     * d'après la spécialité du chirurgien. Comparaisons de chaînes: à appeler
+     * à la construction de l'index de compatibilité, pas à chaque assignation.
+     */
+    uint32_t getTypesOperationCompatibles() const {
+        if (!chirurgien) return 0;
+        if (chirurgien->specialite.empty() || chirurgien->specialite == SPECIALITE_CHIRURGIE_GENERALE) {
+            return TOUS_TYPES_OPERATION;
+        }
+
+        uint32_t masque = 0;
+        for (size_t t = 0; t < NOMBRE_TYPES_OPERATION; t++) {
+            TypeOperation type = static_cast<TypeOperation>(t);
+            if (chirurgien->specialite == specialiteChirurgicale(type)) {
+                masque |= masqueTypeOperation(type);
+            }
+        }
+        return masque;
+    }
+
     /**
      * Nombre total de membres
      */
@@ -160,6 +182,7 @@ public:
             {"infirmiers", infirmiersJson},
             {"disponible", disponible},
             {"estComplete", estComplete()},
+            {"specialite", chirurgien ? chirurgien->specialite : ""},
             {"nombreMembres", getNombreMembres()}
         };
     }
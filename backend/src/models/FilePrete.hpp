@@ -0,0 +1,92 @@
+#ifndef FILE_PRETE_HPP
+#define FILE_PRETE_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include "../enums/AlgorithmeOrdonnancement.hpp"
+#include "../enums/TypeOperation.hpp"
+#include "Patient.hpp"
+#include "TasIndexe.hpp"
+
+namespace AutoMed {
+
+/**
+ * File des patients prêts à être opérés, ordonnée par une politique
+ *
+ * La salle d'attente garde les patients (emplacements) et lui notifie les
+ * entrées/sorties; la file ne connaît que les emplacements. Les appels
+ * virtuels servent au chemin générique; un moteur spécialisé sur la
+ * politique appelle directement l'implémentation (classe finale).
+ */
+class FilePrete {
+public:
+    static constexpr size_t AUCUN_EMPLACEMENT = static_cast<size_t>(-1);
+
+    virtual ~FilePrete() {}
+
+    virtual AlgorithmeOrdonnancement getAlgorithme() const = 0;
+    virtual void inserer(size_t emplacement, const Patient& patient, uint64_t sequence) = 0;
+    virtual void retirer(size_t emplacement, TypeOperation type) = 0;
+
+    /**
+     * Emplacement du prochain patient parmi les types autorisés (AUCUN_EMPLACEMENT si aucun)
+     */
+    virtual size_t selectionner(uint32_t typesAutorises) const = 0;
+    virtual void reserver(size_t nombreEmplacements) = 0;
+    virtual void vider() = 0;
+};
+
+/**
+ * File d'une politique à clé fixe (calculée à l'entrée du patient)
+ *
+ * Un tas indexé par type d'opération: sélection parmi les types autorisés
+ * en comparant au plus NOMBRE_TYPES_OPERATION sommets, insertion et
+ * retrait en O(log n). La politique fournit:
+ *   using Cle = ...;                      (ordonnée par operator<, unique)
+ *   static Cle cle(const Patient&, uint64_t sequence);
+ *   static constexpr AlgorithmeOrdonnancement algorithme;
+ */
+template <typename Politique>
+class FilePreteParCle final : public FilePrete {
+private:
+    using Cle = typename Politique::Cle;
+
+    std::array<TasIndexe<Cle>, NOMBRE_TYPES_OPERATION> tas;
+
+public:
+    AlgorithmeOrdonnancement getAlgorithme() const override { return Politique::algorithme; }
+
+    void inserer(size_t emplacement, const Patient& patient, uint64_t sequence) override {
+        tas[static_cast<size_t>(patient.getTypeOperation())].inserer(emplacement, Politique::cle(patient, sequence));
+    }
+
+    void retirer(size_t emplacement, TypeOperation type) override {
+        tas[static_cast<size_t>(type)].retirer(emplacement);
+    }
+
+    size_t selectionner(uint32_t typesAutorises) const override {
+        size_t meilleur = AUCUN_EMPLACEMENT;
+        const Cle* meilleureCle = nullptr;
+        for (size_t t = 0; t < NOMBRE_TYPES_OPERATION; t++) {
+            if (!(typesAutorises & (1u << t)) || tas[t].estVide()) continue;
+            if (!meilleureCle || tas[t].getCleMinimum() < *meilleureCle) {
+                meilleureCle = &tas[t].getCleMinimum();
+                meilleur = tas[t].getMinimum();
+            }
+        }
+        return meilleur;
+    }
+
+    void reserver(size_t nombreEmplacements) override {
+        for (auto& t : tas) t.reserver(nombreEmplacements);
+    }
+
+    void vider() override {
+        for (auto& t : tas) t.vider();
+    }
+};
+
+} // namespace AutoMed
+
+#endif // FILE_PRETE_HPP
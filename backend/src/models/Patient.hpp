@@ -1,69 +1,118 @@
 #ifndef PATIENT_HPP
 #define PATIENT_HPP
 
+#include <charconv>
 #include <string>
 #include <ctime>
+#include <ostream>
 #include <sstream>
 #include <nlohmann/json.hpp>
 #include "../enums/PrioritePatient.hpp"
 #include "../enums/TypeOperation.hpp"
+#include "PoolNoms.hpp"
 
 namespace AutoMed {
 
+class Patient;
+
+/**
+ * Nom complet d'un patient à écrire dans un flux (traces), sans chaîne
+ * intermédiaire
+ */
+struct NomComplet {
+    const Patient* patient;
+};
+
+std::ostream& operator<<(std::ostream& flux, const NomComplet& nomComplet);
+
 /**
  * Représente un patient dans le système hospitalier
+ *
+ * Les champs lus par l'ordonnancement et les statistiques sont regroupés en
+ * tête (40 octets avec le remplissage); les noms, froids, ne sont que des
+ * pointeurs vers des chaînes partagées (PoolNoms ou liste constante du
+ * générateur). Sans nom explicite, le nom est « Patient_<id> ». Le patient
+ * entier tient dans une ligne de cache (vérifié à la compilation).
  */
 class Patient {
 private:
-    int id;
-    std::string nom;
-    std::string prenom;
-    PrioritePatient priorite;
-    TypeOperation typeOperation;
-    int dureeEstimeeMinutes;  // Durée estimée de l'opération en minutes
     time_t horodatageArrivee; // Timestamp d'arrivée dans le système
     time_t horodatageDebutOperation; // Timestamp de début d'opération (0 si pas encore commencé)
     time_t horodatageFinOperation;   // Timestamp de fin d'opération (0 si pas encore terminé)
+    int id;
+    int dureeEstimeeMinutes;  // Durée estimée de l'opération en minutes
+    PrioritePatient priorite;
+    TypeOperation typeOperation;
+    const std::string* nom;     // nullptr: nom par défaut « Patient_<id> »
+    const std::string* prenom;
+
+    static const std::string* chaineVide() {
+        static const std::string vide;
+        return &vide;
+    }
 
 public:
     /**
-     * Constructeur complet
+     * Constructeur complet (noms internés dans le pool)
      */
     Patient(int id, 
             const std::string& nom, 
             const std::string& prenom,
             PrioritePatient priorite,
             TypeOperation typeOperation,
-            int dureeEstimeeMinutes)
-        : id(id), 
-          nom(nom), 
-          prenom(prenom),
+            int dureeEstimeeMinutes,
+            time_t horodatageArrivee = 0)
+        : horodatageArrivee(horodatageArrivee),
+          horodatageDebutOperation(0),
+          horodatageFinOperation(0),
+          id(id), 
+          dureeEstimeeMinutes(dureeEstimeeMinutes),
           priorite(priorite),
           typeOperation(typeOperation),
-          dureeEstimeeMinutes(dureeEstimeeMinutes),
-          horodatageArrivee(std::time(nullptr)),
+          nom(PoolNoms::instance().interner(nom)), 
+          prenom(PoolNoms::instance().interner(prenom)) {}
+
+    /**
+     * Constructeur du générateur: nom par défaut et prénom pris dans une
+     * chaîne qui survit au patient (aucune copie, aucun verrou), arrivée
+     * en temps virtuel
+     */
+    Patient(int id,
+            const std::string* prenom,
+            PrioritePatient priorite,
+            TypeOperation typeOperation,
+            int dureeEstimeeMinutes,
+            time_t horodatageArrivee)
+        : horodatageArrivee(horodatageArrivee),
           horodatageDebutOperation(0),
-          horodatageFinOperation(0) {}
+          horodatageFinOperation(0),
+          id(id),
+          dureeEstimeeMinutes(dureeEstimeeMinutes),
+          priorite(priorite),
+          typeOperation(typeOperation),
+          nom(nullptr),
+          prenom(prenom ? prenom : chaineVide()) {}
 
     /**
      * Constructeur par défaut
      */
     Patient() 
-        : id(0), 
-          nom(""), 
-          prenom(""),
+        : horodatageArrivee(0),
+          horodatageDebutOperation(0),
+          horodatageFinOperation(0),
+          id(0), 
+          dureeEstimeeMinutes(0),
           priorite(PrioritePatient::ELECTIVE),
           typeOperation(TypeOperation::CARDIAQUE),
-          dureeEstimeeMinutes(0),
-          horodatageArrivee(std::time(nullptr)),
-          horodatageDebutOperation(0),
-          horodatageFinOperation(0) {}
+          nom(chaineVide()), 
+          prenom(chaineVide()) {}
 
     // Getters
     int getId() const { return id; }
-    std::string getNom() const { return nom; }
-    std::string getPrenom() const { return prenom; }
-    std::string getNomComplet() const { return prenom + " " + nom; }
+    std::string getNom() const { return nom ? *nom : "Patient_" + std::to_string(id); }
+    std::string getPrenom() const { return *prenom; }
+    std::string getNomComplet() const { return *prenom + " " + getNom(); }
+    NomComplet nomComplet() const { return NomComplet{this}; }
     PrioritePatient getPriorite() const { return priorite; }
     TypeOperation getTypeOperation() const { return typeOperation; }
     int getDureeEstimeeMinutes() const { return dureeEstimeeMinutes; }
@@ -73,8 +122,8 @@ public:
 
     // Setters
     void setId(int newId) { id = newId; }
-    void setNom(const std::string& newNom) { nom = newNom; }
-    void setPrenom(const std::string& newPrenom) { prenom = newPrenom; }
+    void setNom(const std::string& newNom) { nom = PoolNoms::instance().interner(newNom); }
+    void setPrenom(const std::string& newPrenom) { prenom = PoolNoms::instance().interner(newPrenom); }
     void setPriorite(PrioritePatient newPriorite) { priorite = newPriorite; }
     void setTypeOperation(TypeOperation newType) { typeOperation = newType; }
     void setDureeEstimeeMinutes(int duree) { dureeEstimeeMinutes = duree; }
@@ -85,23 +134,24 @@ public:
     /**
      * Marque le début de l'opération avec le temps virtuel
      */
-    void commencerOperation(time_t tempsVirtuel = 0) {
-        horodatageDebutOperation = (tempsVirtuel > 0) ? tempsVirtuel : std::time(nullptr);
+    void commencerOperation(time_t tempsVirtuel) {
+        horodatageDebutOperation = tempsVirtuel;
     }
 
     /**
      * Marque la fin de l'opération avec le temps virtuel
      */
-    void terminerOperation(time_t tempsVirtuel = 0) {
-        horodatageFinOperation = (tempsVirtuel > 0) ? tempsVirtuel : std::time(nullptr);
+    void terminerOperation(time_t tempsVirtuel) {
+        horodatageFinOperation = tempsVirtuel;
     }
 
     /**
-     * Calcule le temps d'attente en minutes
+     * Calcule le temps d'attente en minutes (jusqu'à maintenant si
+     * l'opération n'a pas commencé)
      */
-    int getTempsAttenteMinutes() const {
+    int getTempsAttenteMinutes(time_t maintenant) const {
         if (horodatageDebutOperation == 0) {
-            return static_cast<int>(std::difftime(std::time(nullptr), horodatageArrivee) / 60);
+            return static_cast<int>(std::difftime(maintenant, horodatageArrivee) / 60);
         }
         return static_cast<int>(std::difftime(horodatageDebutOperation, horodatageArrivee) / 60);
     }
@@ -133,11 +183,11 @@ public:
     /**
      * Conversion vers JSON pour l'API
      */
-    nlohmann::json toJson() const {
+    nlohmann::json toJson(time_t maintenant) const {
         return nlohmann::json{
             {"id", id},
-            {"nom", nom},
-            {"prenom", prenom},
+            {"nom", getNom()},
+            {"prenom", *prenom},
             {"nomComplet", getNomComplet()},
             {"priorite", prioriteToString(priorite)},
             {"typeOperation", typeOperationToString(typeOperation)},
@@ -145,7 +195,7 @@ public:
             {"horodatageArrivee", horodatageArrivee},
             {"horodatageDebutOperation", horodatageDebutOperation},
             {"horodatageFinOperation", horodatageFinOperation},
-            {"tempsAttenteMinutes", getTempsAttenteMinutes()},
+            {"tempsAttenteMinutes", getTempsAttenteMinutes(maintenant)},
             {"dureeReelleMinutes", getDureeReelleMinutes()},
             {"estEnOperation", estEnOperation()},
             {"operationTerminee", operationTerminee()}
@@ -155,17 +205,36 @@ public:
     /**
      * Conversion vers string pour debug
      */
-    std::string toString() const {
+    std::string toString(time_t maintenant) const {
         std::ostringstream oss;
-        oss << "Patient #" << id << ": " << getNomComplet()
+        oss << "Patient #" << id << ": " << nomComplet()
             << " | Priorité: " << prioriteToString(priorite)
             << " | Type: " << typeOperationToString(typeOperation)
             << " | Durée estimée: " << dureeEstimeeMinutes << "min"
-            << " | Temps d'attente: " << getTempsAttenteMinutes() << "min";
+            << " | Temps d'attente: " << getTempsAttenteMinutes(maintenant) << "min";
         return oss.str();
     }
+
+    /**
+     * Écrit « prénom nom » dans le flux
+     */
+    std::ostream& ecrireNomComplet(std::ostream& flux) const {
+        flux.write(prenom->data(), static_cast<std::streamsize>(prenom->size()));
+        flux.put(' ');
+        if (nom) return flux.write(nom->data(), static_cast<std::streamsize>(nom->size()));
+        
+        char tampon[24] = "Patient_";
+        char* fin = std::to_chars(tampon + 8, tampon + sizeof(tampon), id).ptr;
+        return flux.write(tampon, fin - tampon);
+    }
 };
 
+static_assert(sizeof(Patient) <= 64, "Patient doit tenir dans une ligne de cache");
+
+inline std::ostream& operator<<(std::ostream& flux, const NomComplet& nomComplet) {
+    return nomComplet.patient->ecrireNomComplet(flux);
+}
+
 } // namespace AutoMed
 
 #endif // PATIENT_HPP
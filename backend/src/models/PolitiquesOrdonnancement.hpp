@@ -0,0 +1,170 @@
+#ifndef POLITIQUES_ORDONNANCEMENT_HPP
+#define POLITIQUES_ORDONNANCEMENT_HPP
+
+#include <cstdint>
+#include <ctime>
+#include <memory>
+#include <utility>
+#include "../enums/AlgorithmeOrdonnancement.hpp"
+#include "../enums/PrioritePatient.hpp"
+#include "FilePrete.hpp"
+#include "Patient.hpp"
+
+namespace AutoMed {
+
+/**
+ * Politiques d'ordonnancement
+ *
+ * Une politique déclare son algorithme, la clé d'ordre d'un patient (à clé
+ * égale, le rang d'arrivée départage) et sa file (`File`). Ajouter une
+ * politique: une valeur dans AlgorithmeOrdonnancement, une structure ici et
+ * une ligne dans avecPolitique().
+ */
+
+/**
+ * Premier arrivé, premier servi
+ */
+struct PolitiqueFCFS {
+    static constexpr AlgorithmeOrdonnancement algorithme = AlgorithmeOrdonnancement::FCFS;
+    using Cle = uint64_t;
+    using File = FilePreteParCle<PolitiqueFCFS>;
+
+    static Cle cle(const Patient&, uint64_t sequence) { return sequence; }
+};
+
+/**
+ * Urgence > Elective > Ambulatoire
+ */
+struct PolitiquePriorite {
+    static constexpr AlgorithmeOrdonnancement algorithme = AlgorithmeOrdonnancement::PRIORITE;
+    using Cle = std::pair<int, uint64_t>;
+    using File = FilePreteParCle<PolitiquePriorite>;
+
+    static Cle cle(const Patient& patient, uint64_t sequence) {
+        return Cle(static_cast<int>(patient.getPriorite()), sequence);
+    }
+};
+
+/**
+ * Plus courte durée estimée d'abord
+ */
+struct PolitiqueSJF {
+    static constexpr AlgorithmeOrdonnancement algorithme = AlgorithmeOrdonnancement::SJF;
+    using Cle = std::pair<int, uint64_t>;
+    using File = FilePreteParCle<PolitiqueSJF>;
+
+    static Cle cle(const Patient& patient, uint64_t sequence) {
+        return Cle(patient.getDureeEstimeeMinutes(), sequence);
+    }
+};
+
+/**
+ * Échéance la plus proche: arrivée + délai cible de la priorité
+ */
+struct PolitiqueEDF {
+    static constexpr AlgorithmeOrdonnancement algorithme = AlgorithmeOrdonnancement::EDF;
+    using Cle = std::pair<time_t, uint64_t>;
+    using File = FilePreteParCle<PolitiqueEDF>;
+
+    static int delaiCibleMinutes(PrioritePatient priorite) {
+        switch (priorite) {
+            case PrioritePatient::URGENCE: return 60;
+            case PrioritePatient::AMBULATOIRE: return 240;   // Sortie le jour même
+            case PrioritePatient::ELECTIVE: return 480;
+            default: return 480;
+        }
+    }
+
+    static Cle cle(const Patient& patient, uint64_t sequence) {
+        return Cle(patient.getHorodatageArrivee() + delaiCibleMinutes(patient.getPriorite()) * 60, sequence);
+    }
+};
+
+/**
+ * Plus courte durée pondérée: durée estimée / poids de la priorité
+ */
+struct PolitiqueWSJF {
+    static constexpr AlgorithmeOrdonnancement algorithme = AlgorithmeOrdonnancement::WSJF;
+    using Cle = std::pair<double, uint64_t>;
+    using File = FilePreteParCle<PolitiqueWSJF>;
+
+    static double poids(PrioritePatient priorite) {
+        switch (priorite) {
+            case PrioritePatient::URGENCE: return 10.0;
+            case PrioritePatient::ELECTIVE: return 2.0;
+            case PrioritePatient::AMBULATOIRE: return 1.0;
+            default: return 1.0;
+        }
+    }
+
+    static Cle cle(const Patient& patient, uint64_t sequence) {
+        return Cle(patient.getDureeEstimeeMinutes() / poids(patient.getPriorite()), sequence);
+    }
+};
+
+/**
+ * Priorité avec vieillissement: un patient gagne un niveau de priorité
+ * toutes les MINUTES_PAR_NIVEAU minutes d'attente.
+ *
+ * Priorité effective à l'instant t: niveau - (t - arrivée) / période. Le
+ * terme en t est commun à tous les patients, l'ordre ne dépend donc que de
+ * niveau * période + arrivée: clé fixe, pas de réordonnancement périodique.
+ */
+struct PolitiqueVieillissement {
+    static constexpr AlgorithmeOrdonnancement algorithme = AlgorithmeOrdonnancement::VIEILLISSEMENT;
+    static constexpr int MINUTES_PAR_NIVEAU = 120;
+    using Cle = std::pair<int64_t, uint64_t>;
+    using File = FilePreteParCle<PolitiqueVieillissement>;
+
+    static Cle cle(const Patient& patient, uint64_t sequence) {
+        int64_t niveau = static_cast<int64_t>(patient.getPriorite());
+        return Cle(niveau * MINUTES_PAR_NIVEAU * 60 + static_cast<int64_t>(patient.getHorodatageArrivee()), sequence);
+    }
+};
+
+/**
+ * Planification par anticipation (voir PlanificateurAnticipation)
+ *
+ * Le moteur ne sélectionne pas patient par patient; la file garde l'ordre
+ * WSJF, utilisé pour la sélection générique et comme ordre initial du plan.
+ */
+struct PolitiqueAnticipation {
+    static constexpr AlgorithmeOrdonnancement algorithme = AlgorithmeOrdonnancement::ANTICIPATION;
+    using Cle = PolitiqueWSJF::Cle;
+    using File = FilePreteParCle<PolitiqueAnticipation>;
+
+    static Cle cle(const Patient& patient, uint64_t sequence) {
+        return PolitiqueWSJF::cle(patient, sequence);
+    }
+};
+
+/**
+ * Appelle fonction(Politique{}) avec la politique de l'algorithme: seul
+ * aiguillage à l'exécution, fait une fois par simulation
+ */
+template <typename Fonction>
+auto avecPolitique(AlgorithmeOrdonnancement algorithme, Fonction&& fonction) {
+    switch (algorithme) {
+        case AlgorithmeOrdonnancement::PRIORITE: return fonction(PolitiquePriorite{});
+        case AlgorithmeOrdonnancement::SJF: return fonction(PolitiqueSJF{});
+        case AlgorithmeOrdonnancement::EDF: return fonction(PolitiqueEDF{});
+        case AlgorithmeOrdonnancement::WSJF: return fonction(PolitiqueWSJF{});
+        case AlgorithmeOrdonnancement::VIEILLISSEMENT: return fonction(PolitiqueVieillissement{});
+        case AlgorithmeOrdonnancement::ANTICIPATION: return fonction(PolitiqueAnticipation{});
+        case AlgorithmeOrdonnancement::FCFS:
+        default: return fonction(PolitiqueFCFS{});
+    }
+}
+
+/**
+ * Crée la file de la politique de l'algorithme
+ */
+inline std::unique_ptr<FilePrete> creerFilePrete(AlgorithmeOrdonnancement algorithme) {
+    return avecPolitique(algorithme, [](auto politique) -> std::unique_ptr<FilePrete> {
+        return std::unique_ptr<FilePrete>(new typename decltype(politique)::File());
+    });
+}
+
+} // namespace AutoMed
+
+#endif // POLITIQUES_ORDONNANCEMENT_HPP
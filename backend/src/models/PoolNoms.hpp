@@ -0,0 +1,50 @@
+#ifndef POOL_NOMS_HPP
+#define POOL_NOMS_HPP
+
+#include <mutex>
+#include <string>
+#include <unordered_set>
+
+namespace AutoMed {
+
+/**
+ * Pool de chaînes internées, partagé par le processus
+ *
+ * Chaque nom distinct n'est stocké qu'une fois; les patients ne gardent
+ * qu'un pointeur vers lui. Les éléments d'un unordered_set ne bougent
+ * jamais (même au rehachage): le pointeur reste valide et se lit sans
+ * verrou, seul l'internement le prend.
+ */
+class PoolNoms {
+private:
+    std::unordered_set<std::string> chaines;
+    std::mutex verrou;
+
+    PoolNoms() = default;
+
+public:
+    PoolNoms(const PoolNoms&) = delete;
+    PoolNoms& operator=(const PoolNoms&) = delete;
+
+    static PoolNoms& instance() {
+        static PoolNoms pool;
+        return pool;
+    }
+
+    /**
+     * Renvoie l'exemplaire unique de chaine (ajouté au premier appel)
+     */
+    const std::string* interner(const std::string& chaine) {
+        std::lock_guard<std::mutex> garde(verrou);
+        return &*chaines.insert(chaine).first;
+    }
+
+    size_t getNombreChaines() {
+        std::lock_guard<std::mutex> garde(verrou);
+        return chaines.size();
+    }
+};
+
+} // namespace AutoMed
+
+#endif // POOL_NOMS_HPP
@@ -1,47 +1,179 @@
 #ifndef SALLE_ATTENTE_HPP
 #define SALLE_ATTENTE_HPP
 
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <ctime>
+#include <memory>
 #include <string>
+#include <utility>
 #include <vector>
-#include <algorithm>
 #include <nlohmann/json.hpp>
 #include "../enums/PrioritePatient.hpp"
+#include "../enums/TypeOperation.hpp"
 #include "Patient.hpp"
+#include "PolitiquesOrdonnancement.hpp"
+#include "TasIndexe.hpp"
 
 namespace AutoMed {
 
 /**
  * Représente une salle d'attente avec file de patients
+ *
+ * Les patients sont rangés dans des emplacements réutilisés, indexés par id
+ * (recherche en O(1)). Les index sont pré-alloués pour la capacité de la
+ * salle: une simulation ne réalloue pas en cours de route. La file de la
+ * politique d'ordonnancement de la salle donne le prochain patient en
+ * O(log n), éventuellement restreint aux types qu'une équipe libre peut
+ * opérer; à clé égale, le premier arrivé passe en premier.
  */
 class SalleAttente {
 private:
+    struct EntreeAttente {
+        Patient* patient;       // nullptr si l'emplacement est libre
+        uint64_t sequence;      // Rang d'arrivée dans la salle
+        time_t horodatageArrivee;
+        PrioritePatient priorite;
+        TypeOperation typeOperation;
+    };
+
     int id;
     std::string nom;
-    std::vector<Patient*> fileAttente;
+    std::vector<EntreeAttente> entrees;
+    std::vector<size_t> emplacementsLibres;
+    std::vector<size_t> emplacementParId;       // Id patient -> emplacement (AUCUN_EMPLACEMENT si absent)
+    int nombrePatients;
+    std::unique_ptr<FilePrete> file;            // Ordre de passage (politique de la salle)
+    FilePreteParCle<PolitiqueFCFS> fileUrgences; // Urgences seules, par ordre d'arrivée (préemption)
+    uint64_t prochaineSequence;
+    uint64_t sequenceDernierRetrait;            // Rang du dernier patient sorti (remise en attente)
     int capaciteMax;
 
+    // Agrégats tenus à jour à chaque entrée/sortie
+    std::array<int, 3> nombreParPriorite;
+    std::array<int, NOMBRE_TYPES_OPERATION> nombreParType;
+    int64_t sommeHorodatagesArrivee;
+    TasIndexe<time_t> tasHorodatageArrivee;     // Arrivée la plus ancienne = attente maximale
+
+    static size_t indicePriorite(PrioritePatient priorite) {
+        return static_cast<size_t>(priorite) - static_cast<size_t>(PrioritePatient::URGENCE);
+    }
+
+    /**
+     * Retire l'emplacement de tous les index et le libère
+     * (File: type statique de la file, pour un appel direct sans indirection)
+     */
+    template <typename File>
+    Patient* retirerEmplacement(size_t emplacement, File& fileSalle) {
+        if (emplacement == FilePrete::AUCUN_EMPLACEMENT) return nullptr;
+
+        const EntreeAttente& entree = entrees[emplacement];
+        Patient* patient = entree.patient;
+        size_t type = static_cast<size_t>(entree.typeOperation);
+        sequenceDernierRetrait = entree.sequence;
+        fileSalle.retirer(emplacement, entree.typeOperation);
+        if (entree.priorite == PrioritePatient::URGENCE) fileUrgences.retirer(emplacement, entree.typeOperation);
+        tasHorodatageArrivee.retirer(emplacement);
+        nombreParPriorite[indicePriorite(entree.priorite)]--;
+        nombreParType[type]--;
+        sommeHorodatagesArrivee -= static_cast<int64_t>(entree.horodatageArrivee);
+        emplacementParId[static_cast<size_t>(patient->getId())] = FilePrete::AUCUN_EMPLACEMENT;
+        nombrePatients--;
+        entrees[emplacement].patient = nullptr;
+        emplacementsLibres.push_back(emplacement);
+        return patient;
+    }
+
+    /**
+     * Emplacement d'un patient (AUCUN_EMPLACEMENT s'il n'est pas dans la salle)
+     */
+    size_t trouverEmplacement(int patientId) const {
+        size_t indice = static_cast<size_t>(patientId);
+        return patientId >= 0 && indice < emplacementParId.size() ? emplacementParId[indice]
+                                                                   : FilePrete::AUCUN_EMPLACEMENT;
+    }
+
 public:
+    static constexpr size_t CAPACITE_PREALLOUEE_MAX = 1024;     // Au-delà, les index grandissent à la demande
+
     /**
      * Constructeur
      */
-    SalleAttente(int id, const std::string& nom, int capaciteMax = 100)
+    SalleAttente(int id, const std::string& nom, int capaciteMax = 100,
+                 AlgorithmeOrdonnancement algorithme = AlgorithmeOrdonnancement::FCFS)
         : id(id),
           nom(nom),
-          capaciteMax(capaciteMax) {}
+          nombrePatients(0),
+          file(creerFilePrete(algorithme)),
+          prochaineSequence(0),
+          sequenceDernierRetrait(0),
+          capaciteMax(capaciteMax),
+          nombreParPriorite{},
+          nombreParType{},
+          sommeHorodatagesArrivee(0) {
+        size_t prevus = std::min(static_cast<size_t>(std::max(0, capaciteMax)), CAPACITE_PREALLOUEE_MAX);
+        entrees.reserve(prevus);
+        emplacementsLibres.reserve(prevus);
+        file->reserver(prevus);
+        fileUrgences.reserver(prevus);
+        tasHorodatageArrivee.reserver(prevus);
+    }
+
+    /**
+     * Prépare l'index par id pour les patients d'id inférieur à nombreIds
+     */
+    void reserverIds(size_t nombreIds) {
+        if (nombreIds > emplacementParId.size()) {
+            emplacementParId.resize(nombreIds, FilePrete::AUCUN_EMPLACEMENT);
+        }
+    }
 
     /**
      * Destructeur - Ne supprime pas les pointeurs (gestion externe)
      */
     ~SalleAttente() {
-        fileAttente.clear();
+        vider();
     }
 
+    SalleAttente(const SalleAttente&) = delete;
+    SalleAttente& operator=(const SalleAttente&) = delete;
+
     // Getters
     int getId() const { return id; }
     std::string getNom() const { return nom; }
     int getCapaciteMax() const { return capaciteMax; }
-    int getNombrePatients() const { return fileAttente.size(); }
-    const std::vector<Patient*>& getFileAttente() const { return fileAttente; }
+    AlgorithmeOrdonnancement getAlgorithme() const { return file->getAlgorithme(); }
+    int getNombrePatients() const { return nombrePatients; }
+    uint64_t getSequenceDernierRetrait() const { return sequenceDernierRetrait; }
+
+    /**
+     * Patients en attente dans l'ordre d'arrivée (copie triée, pour l'affichage)
+     */
+    std::vector<Patient*> getFileAttente() const {
+        std::vector<const EntreeAttente*> occupees;
+        occupees.reserve(static_cast<size_t>(nombrePatients));
+        for (const auto& entree : entrees) {
+            if (entree.patient) occupees.push_back(&entree);
+        }
+        std::sort(occupees.begin(), occupees.end(),
+            [](const EntreeAttente* a, const EntreeAttente* b) { return a->sequence < b->sequence; });
+
+        std::vector<Patient*> file;
+        file.reserve(occupees.size());
+        for (const auto* entree : occupees) file.push_back(entree->patient);
+        return file;
+    }
+
+    /**
+     * Parcourt les patients en attente sans ordre particulier: fonction(patient, sequence)
+     */
+    template <typename Fonction>
+    void parcourirPatients(Fonction fonction) const {
+        for (const auto& entree : entrees) {
+            if (entree.patient) fonction(entree.patient, entree.sequence);
+        }
+    }
 
     // Setters
     void setNom(const std::string& newNom) { nom = newNom; }
@@ -51,166 +183,182 @@ public:
      * Vérifie si la salle est pleine
      */
     bool estPleine() const {
-        return fileAttente.size() >= static_cast<size_t>(capaciteMax);
+        return nombrePatients >= capaciteMax;
     }
 
     /**
      * Vérifie si la salle est vide
      */
     bool estVide() const {
-        return fileAttente.empty();
+        return nombrePatients == 0;
     }
 
     /**
-     * Ajoute un patient à la file d'attente
+     * Ajoute un patient à la file d'attente (en dernière position d'arrivée)
      */
     bool ajouterPatient(Patient* patient) {
-        if (!patient || estPleine()) {
+        if (!ajouterPatient(patient, prochaineSequence)) {
             return false;
         }
-
-        fileAttente.push_back(patient);
+        prochaineSequence++;
         return true;
     }
 
     /**
-     * Retire un patient de la file d'attente par ID
+     * Remet en attente un patient sorti de la salle à son rang d'origine
+     * (getSequenceDernierRetrait au moment de sa sortie): un patient reporté
+     * ne perd pas sa place
      */
-    Patient* retirerPatient(int patientId) {
-        auto it = std::find_if(fileAttente.begin(), fileAttente.end(),
-            [patientId](Patient* p) { return p->getId() == patientId; });
+    bool ajouterPatient(Patient* patient, uint64_t sequence) {
+        if (!patient || patient->getId() < 0 || estPleine()
+            || trouverEmplacement(patient->getId()) != FilePrete::AUCUN_EMPLACEMENT) {
+            return false;
+        }
 
-        if (it != fileAttente.end()) {
-            Patient* patient = *it;
-            fileAttente.erase(it);
-            return patient;
+        size_t emplacement;
+        if (!emplacementsLibres.empty()) {
+            emplacement = emplacementsLibres.back();
+            emplacementsLibres.pop_back();
+        } else {
+            emplacement = entrees.size();
+            entrees.push_back(EntreeAttente{nullptr, 0, 0, PrioritePatient::ELECTIVE, TypeOperation::CARDIAQUE});
         }
 
-        return nullptr;
+        time_t arrivee = patient->getHorodatageArrivee();
+        entrees[emplacement] = EntreeAttente{patient, sequence, arrivee, patient->getPriorite(),
+                                             patient->getTypeOperation()};
+        reserverIds(static_cast<size_t>(patient->getId()) + 1);
+        emplacementParId[static_cast<size_t>(patient->getId())] = emplacement;
+        nombrePatients++;
+
+        nombreParPriorite[indicePriorite(patient->getPriorite())]++;
+        sommeHorodatagesArrivee += static_cast<int64_t>(arrivee);
+        tasHorodatageArrivee.inserer(emplacement, arrivee);
+
+        nombreParType[static_cast<size_t>(patient->getTypeOperation())]++;
+        file->inserer(emplacement, *patient, sequence);
+        if (patient->getPriorite() == PrioritePatient::URGENCE) fileUrgences.inserer(emplacement, *patient, sequence);
+        return true;
     }
 
     /**
-     * Récupère le prochain patient selon l'algorithme FCFS (First Come First Serve)
+     * Retire un patient de la file d'attente par ID
      */
-    Patient* getProchainPatientFCFS() {
+    Patient* retirerPatient(int patientId) {
+        return retirerEmplacement(trouverEmplacement(patientId), *file);
+    }
+
+    /**
+     * Récupère le prochain patient selon la politique de la salle
+     */
+    Patient* getProchainPatient(uint32_t typesAutorises = TOUS_TYPES_OPERATION) {
         if (estVide()) {
             return nullptr;
         }
-
-        Patient* patient = fileAttente.front();
-        fileAttente.erase(fileAttente.begin());
-        return patient;
+        return retirerEmplacement(file->selectionner(typesAutorises), *file);
     }
 
     /**
-     * Récupère le prochain patient selon la priorité (Urgence > Elective > Ambulatoire)
+     * Même chose, la politique étant connue à la compilation: sélection et
+     * retrait appelés directement (inlinés). La salle doit avoir été créée
+     * avec cette politique, sinon le chemin générique est utilisé.
      */
-    Patient* getProchainPatientPriorite() {
+    template <typename Politique>
+    Patient* getProchainPatient(uint32_t typesAutorises = TOUS_TYPES_OPERATION) {
         if (estVide()) {
             return nullptr;
         }
+        if (file->getAlgorithme() != Politique::algorithme) {
+            return getProchainPatient(typesAutorises);
+        }
+        auto& fileSalle = static_cast<typename Politique::File&>(*file);
+        return retirerEmplacement(fileSalle.selectionner(typesAutorises), fileSalle);
+    }
 
-        // Trouver le patient avec la plus haute priorité (valeur la plus petite)
-        auto it = std::min_element(fileAttente.begin(), fileAttente.end(),
-            [](Patient* a, Patient* b) {
-                return static_cast<int>(a->getPriorite()) < static_cast<int>(b->getPriorite());
-            });
+    /**
+     * Première urgence arrivée parmi les types autorisés, sans la retirer (nullptr si aucune)
+     */
+    Patient* consulterProchaineUrgence(uint32_t typesAutorises = TOUS_TYPES_OPERATION) const {
+        size_t emplacement = fileUrgences.selectionner(typesAutorises);
+        return emplacement == FilePrete::AUCUN_EMPLACEMENT ? nullptr : entrees[emplacement].patient;
+    }
 
-        Patient* patient = *it;
-        fileAttente.erase(it);
-        return patient;
+    /**
+     * Retire la première urgence arrivée parmi les types autorisés, quelle que
+     * soit la politique de la salle (nullptr si aucune)
+     */
+    Patient* getProchaineUrgence(uint32_t typesAutorises = TOUS_TYPES_OPERATION) {
+        return retirerEmplacement(fileUrgences.selectionner(typesAutorises), *file);
     }
 
     /**
-     * Récupère le prochain patient selon SJF (Shortest Job First)
+     * Vrai si au moins un patient attend pour l'un des types du masque
      */
-    Patient* getProchainPatientSJF() {
-        if (estVide()) {
-            return nullptr;
+    bool contientTypes(uint32_t types) const {
+        for (size_t t = 0; t < NOMBRE_TYPES_OPERATION; t++) {
+            if ((types & (1u << t)) && nombreParType[t] > 0) return true;
         }
-
-        // Trouver le patient avec la durée estimée la plus courte
-        auto it = std::min_element(fileAttente.begin(), fileAttente.end(),
-            [](Patient* a, Patient* b) {
-                return a->getDureeEstimeeMinutes() < b->getDureeEstimeeMinutes();
-            });
-
-        Patient* patient = *it;
-        fileAttente.erase(it);
-        return patient;
+        return false;
     }
 
     /**
      * Cherche un patient par ID
      */
     Patient* trouverPatient(int patientId) const {
-        auto it = std::find_if(fileAttente.begin(), fileAttente.end(),
-            [patientId](Patient* p) { return p->getId() == patientId; });
-
-        return (it != fileAttente.end()) ? *it : nullptr;
+        size_t emplacement = trouverEmplacement(patientId);
+        return emplacement != FilePrete::AUCUN_EMPLACEMENT ? entrees[emplacement].patient : nullptr;
     }
 
     /**
      * Compte le nombre de patients par priorité
      */
     int compterPatientsPriorite(PrioritePatient priorite) const {
-        return std::count_if(fileAttente.begin(), fileAttente.end(),
-            [priorite](Patient* p) { return p->getPriorite() == priorite; });
+        return nombreParPriorite[indicePriorite(priorite)];
     }
 
     /**
-     * Calcule le temps d'attente moyen en minutes
+     * Calcule le temps d'attente moyen en minutes (à l'instant maintenant)
      */
-    double getTempsAttenteMoyenMinutes() const {
+    double getTempsAttenteMoyenMinutes(time_t maintenant) const {
         if (estVide()) {
             return 0.0;
         }
-
-        int totalTempsAttente = 0;
-        for (const auto& patient : fileAttente) {
-            totalTempsAttente += patient->getTempsAttenteMinutes();
-        }
-
-        return static_cast<double>(totalTempsAttente) / fileAttente.size();
+        double attenteTotaleSecondes = static_cast<double>(maintenant) * getNombrePatients()
+                                     - static_cast<double>(sommeHorodatagesArrivee);
+        return attenteTotaleSecondes / 60.0 / getNombrePatients();
     }
 
     /**
-     * Calcule le temps d'attente maximum en minutes
+     * Calcule le temps d'attente maximum en minutes (celui du patient arrivé le plus tôt)
      */
-    int getTempsAttenteMaxMinutes() const {
+    int getTempsAttenteMaxMinutes(time_t maintenant) const {
         if (estVide()) {
             return 0;
         }
-
-        int maxTemps = 0;
-        for (const auto& patient : fileAttente) {
-            int temps = patient->getTempsAttenteMinutes();
-            if (temps > maxTemps) {
-                maxTemps = temps;
-            }
-        }
-
-        return maxTemps;
+        int maxTemps = static_cast<int>(std::difftime(maintenant, tasHorodatageArrivee.getCleMinimum()) / 60);
+        return std::max(0, maxTemps);
     }
 
     /**
      * Vide complètement la file d'attente
      */
     void vider() {
-        fileAttente.clear();
+        entrees.clear();
+        emplacementsLibres.clear();
+        emplacementParId.clear();
+        nombrePatients = 0;
+        file->vider();
+        fileUrgences.vider();
+        tasHorodatageArrivee.vider();
+        nombreParPriorite.fill(0);
+        nombreParType.fill(0);
+        sommeHorodatagesArrivee = 0;
     }
 
     /**
-     * Conversion vers JSON pour l'API
+     * Résumé de la salle sans la liste des patients, en O(1)
      */
-    nlohmann::json toJson() const {
-        nlohmann::json patientsJson = nlohmann::json::array();
-        for (const auto& patient : fileAttente) {
-            if (patient) {
-                patientsJson.push_back(patient->toJson());
-            }
-        }
-
+    nlohmann::json getResumeJson(time_t maintenant) const {
         return nlohmann::json{
             {"id", id},
             {"nom", nom},
@@ -218,23 +366,38 @@ public:
             {"nombrePatients", getNombrePatients()},
             {"estPleine", estPleine()},
             {"estVide", estVide()},
-            {"patients", patientsJson},
-            {"tempsAttenteMoyenMinutes", getTempsAttenteMoyenMinutes()},
-            {"tempsAttenteMaxMinutes", getTempsAttenteMaxMinutes()},
+            {"tempsAttenteMoyenMinutes", getTempsAttenteMoyenMinutes(maintenant)},
+            {"tempsAttenteMaxMinutes", getTempsAttenteMaxMinutes(maintenant)},
             {"nombreUrgences", compterPatientsPriorite(PrioritePatient::URGENCE)},
             {"nombreElectives", compterPatientsPriorite(PrioritePatient::ELECTIVE)},
             {"nombreAmbulatoires", compterPatientsPriorite(PrioritePatient::AMBULATOIRE)}
         };
     }
 
+    /**
+     * Conversion vers JSON pour l'API
+     */
+    nlohmann::json toJson(time_t maintenant) const {
+        nlohmann::json patientsJson = nlohmann::json::array();
+        for (const auto* patient : getFileAttente()) {
+            if (patient) {
+                patientsJson.push_back(patient->toJson(maintenant));
+            }
+        }
+
+        nlohmann::json json = getResumeJson(maintenant);
+        json["patients"] = patientsJson;
+        return json;
+    }
+
     /**
      * Conversion vers string pour debug
      */
-    std::string toString() const {
+    std::string toString(time_t maintenant) const {
         std::ostringstream oss;
         oss << "SalleAttente #" << id << ": " << nom
             << " | Patients: " << getNombrePatients() << "/" << capaciteMax
-            << " | Temps attente moyen: " << getTempsAttenteMoyenMinutes() << "min";
+            << " | Temps attente moyen: " << getTempsAttenteMoyenMinutes(maintenant) << "min";
         return oss.str();
     }
 };
@@ -4,78 +4,159 @@
 #include <string>
 #include <vector>
 #include <algorithm>
+#include <cstdint>
 #include <ctime>
+#include <sstream>
 #include <nlohmann/json.hpp>
 #include "Patient.hpp"
+#include "TasIndexe.hpp"
 
 namespace AutoMed {
 
 /**
  * Représente un patient en salle de réveil avec son heure d'arrivée
+ * (horloge virtuelle de la simulation)
  */
 struct PatientReveil {
     Patient* patient;
     time_t horodatageEntree;
     int dureeReveilEstimeeMinutes;
 
-    PatientReveil(Patient* p, int dureeReveil)
+    PatientReveil(Patient* p, time_t entree, int dureeReveil)
         : patient(p),
-          horodatageEntree(std::time(nullptr)),
+          horodatageEntree(entree),
           dureeReveilEstimeeMinutes(dureeReveil) {}
 
+    /**
+     * Heure à laquelle le réveil est terminé
+     */
+    time_t getHorodatageSortiePrevue() const {
+        return horodatageEntree + static_cast<time_t>(dureeReveilEstimeeMinutes) * 60;
+    }
+
     /**
      * Calcule le temps passé en salle de réveil en minutes
      */
-    int getTempsReveilMinutes() const {
-        return static_cast<int>(std::difftime(std::time(nullptr), horodatageEntree) / 60);
+    int getTempsReveilMinutes(time_t maintenant) const {
+        return static_cast<int>(std::difftime(maintenant, horodatageEntree) / 60);
     }
 
     /**
      * Vérifie si le patient peut sortir de la salle de réveil
      */
-    bool peutSortir() const {
-        return getTempsReveilMinutes() >= dureeReveilEstimeeMinutes;
+    bool peutSortir(time_t maintenant) const {
+        return maintenant >= getHorodatageSortiePrevue();
     }
 
-    nlohmann::json toJson() const {
+    nlohmann::json toJson(time_t maintenant) const {
         return nlohmann::json{
-            {"patient", patient ? patient->toJson() : nullptr},
+            {"patient", patient ? patient->toJson(maintenant) : nullptr},
             {"horodatageEntree", horodatageEntree},
             {"dureeReveilEstimeeMinutes", dureeReveilEstimeeMinutes},
-            {"tempsReveilMinutes", getTempsReveilMinutes()},
-            {"peutSortir", peutSortir()}
+            {"horodatageSortiePrevue", getHorodatageSortiePrevue()},
+            {"tempsReveilMinutes", getTempsReveilMinutes(maintenant)},
+            {"peutSortir", peutSortir(maintenant)}
         };
     }
 };
 
 /**
  * Représente une salle de réveil post-opératoire
+ *
+ * Toutes les heures sont celles de l'horloge virtuelle, passées par le
+ * moteur. Les patients occupent des emplacements réutilisés, indexés par id;
+ * un tas des heures de sortie prévues donne les patients prêts en
+ * O(k log n) sans parcourir la salle. Occupation moyenne et durée de séjour
+ * sont cumulées à chaque entrée et sortie.
  */
 class SalleReveil {
 private:
+    static constexpr size_t AUCUN_EMPLACEMENT = static_cast<size_t>(-1);
+
     int id;
     std::string nom;
-    std::vector<PatientReveil> patientsEnReveil;
+    std::vector<PatientReveil> emplacements;    // patient == nullptr si libre
+    std::vector<size_t> emplacementsLibres;
+    std::vector<size_t> emplacementParId;       // Id patient -> emplacement (AUCUN_EMPLACEMENT si absent)
+    TasIndexe<time_t> tasSorties;               // Sortie prévue la plus proche en tête
+    int nombrePatients;
     int capaciteMax;
     int dureeReveilDefaultMinutes;  // Durée par défaut si non spécifiée
 
+    // Agrégats tenus à jour à chaque entrée/sortie
+    int64_t sommeHorodatagesEntree;
+    time_t horodatageOuverture;                 // Première entrée (0 tant que la salle n'a servi)
+    time_t horodatageDernierChangement;
+    int64_t occupationCumuleeSecondes;          // Σ patients présents × durée, jusqu'au dernier changement
+    uint64_t nombreSorties;
+    int64_t sommeSejoursSecondes;
+
+    size_t trouverEmplacement(int patientId) const {
+        size_t indice = static_cast<size_t>(patientId);
+        return patientId >= 0 && indice < emplacementParId.size() ? emplacementParId[indice] : AUCUN_EMPLACEMENT;
+    }
+
+    /**
+     * Cumule l'occupation écoulée depuis le dernier changement
+     */
+    void avancer(time_t maintenant) {
+        if (horodatageOuverture == 0) {
+            horodatageOuverture = maintenant;
+        } else if (maintenant > horodatageDernierChangement) {
+            occupationCumuleeSecondes += static_cast<int64_t>(nombrePatients)
+                                       * (maintenant - horodatageDernierChangement);
+        }
+        horodatageDernierChangement = std::max(horodatageDernierChangement, maintenant);
+    }
+
+    Patient* retirerEmplacement(size_t emplacement, time_t maintenant) {
+        if (emplacement == AUCUN_EMPLACEMENT) return nullptr;
+
+        avancer(maintenant);
+        PatientReveil& entree = emplacements[emplacement];
+        Patient* patient = entree.patient;
+        tasSorties.retirer(emplacement);
+        sommeHorodatagesEntree -= static_cast<int64_t>(entree.horodatageEntree);
+        sommeSejoursSecondes += static_cast<int64_t>(maintenant - entree.horodatageEntree);
+        nombreSorties++;
+        emplacementParId[static_cast<size_t>(patient->getId())] = AUCUN_EMPLACEMENT;
+        entree.patient = nullptr;
+        emplacementsLibres.push_back(emplacement);
+        nombrePatients--;
+        return patient;
+    }
+
 public:
+    static constexpr size_t CAPACITE_PREALLOUEE_MAX = 1024;     // Au-delà, les index grandissent à la demande
+
     /**
      * Constructeur
      */
     SalleReveil(int id, const std::string& nom, int capaciteMax = 20, int dureeReveilDefault = 60)
         : id(id),
           nom(nom),
+          nombrePatients(0),
           capaciteMax(capaciteMax),
-          dureeReveilDefaultMinutes(dureeReveilDefault) {}
+          dureeReveilDefaultMinutes(dureeReveilDefault),
+          sommeHorodatagesEntree(0),
+          horodatageOuverture(0),
+          horodatageDernierChangement(0),
+          occupationCumuleeSecondes(0),
+          nombreSorties(0),
+          sommeSejoursSecondes(0) {
+        size_t prevus = std::min(static_cast<size_t>(std::max(0, capaciteMax)), CAPACITE_PREALLOUEE_MAX);
+        emplacements.reserve(prevus);
+        emplacementsLibres.reserve(prevus);
+        tasSorties.reserver(prevus);
+    }
 
     // Getters
     int getId() const { return id; }
     std::string getNom() const { return nom; }
     int getCapaciteMax() const { return capaciteMax; }
-    int getNombrePatients() const { return patientsEnReveil.size(); }
+    int getNombrePatients() const { return nombrePatients; }
     int getDureeReveilDefaultMinutes() const { return dureeReveilDefaultMinutes; }
-    const std::vector<PatientReveil>& getPatientsEnReveil() const { return patientsEnReveil; }
+    uint64_t getNombreSorties() const { return nombreSorties; }
 
     // Setters
     void setNom(const std::string& newNom) { nom = newNom; }
@@ -86,21 +167,22 @@ public:
      * Vérifie si la salle est pleine
      */
     bool estPleine() const {
-        return patientsEnReveil.size() >= static_cast<size_t>(capaciteMax);
+        return nombrePatients >= capaciteMax;
     }
 
     /**
      * Vérifie si la salle est vide
      */
     bool estVide() const {
-        return patientsEnReveil.empty();
+        return nombrePatients == 0;
     }
 
     /**
-     * Ajoute un patient en salle de réveil
+     * Ajoute un patient entré à l'heure maintenant
      */
-    bool ajouterPatient(Patient* patient, int dureeReveilMinutes = -1) {
-        if (!patient || estPleine()) {
+    bool ajouterPatient(Patient* patient, time_t maintenant, int dureeReveilMinutes = -1) {
+        if (!patient || patient->getId() < 0 || estPleine()
+            || trouverEmplacement(patient->getId()) != AUCUN_EMPLACEMENT) {
             return false;
         }
 
@@ -109,124 +191,175 @@ public:
             dureeReveilMinutes = dureeReveilDefaultMinutes;
         }
 
-        patientsEnReveil.emplace_back(patient, dureeReveilMinutes);
+        avancer(maintenant);
+        size_t emplacement;
+        if (!emplacementsLibres.empty()) {
+            emplacement = emplacementsLibres.back();
+            emplacementsLibres.pop_back();
+            emplacements[emplacement] = PatientReveil(patient, maintenant, dureeReveilMinutes);
+        } else {
+            emplacement = emplacements.size();
+            emplacements.emplace_back(patient, maintenant, dureeReveilMinutes);
+        }
+
+        size_t indice = static_cast<size_t>(patient->getId());
+        if (indice >= emplacementParId.size()) emplacementParId.resize(indice + 1, AUCUN_EMPLACEMENT);
+        emplacementParId[indice] = emplacement;
+        tasSorties.inserer(emplacement, emplacements[emplacement].getHorodatageSortiePrevue());
+        sommeHorodatagesEntree += static_cast<int64_t>(maintenant);
+        nombrePatients++;
         return true;
     }
 
     /**
-     * Retire un patient par ID
+     * Retire un patient par ID à l'heure maintenant
      */
-    Patient* retirerPatient(int patientId) {
-        auto it = std::find_if(patientsEnReveil.begin(), patientsEnReveil.end(),
-            [patientId](const PatientReveil& pr) { 
-                return pr.patient && pr.patient->getId() == patientId; 
-            });
-
-        if (it != patientsEnReveil.end()) {
-            Patient* patient = it->patient;
-            patientsEnReveil.erase(it);
-            return patient;
-        }
-
-        return nullptr;
+    Patient* retirerPatient(int patientId, time_t maintenant) {
+        return retirerEmplacement(trouverEmplacement(patientId), maintenant);
     }
 
     /**
      * Cherche un patient par ID
      */
-    PatientReveil* trouverPatient(int patientId) {
-        auto it = std::find_if(patientsEnReveil.begin(), patientsEnReveil.end(),
-            [patientId](const PatientReveil& pr) { 
-                return pr.patient && pr.patient->getId() == patientId; 
-            });
-
-        return (it != patientsEnReveil.end()) ? &(*it) : nullptr;
+    const PatientReveil* trouverPatient(int patientId) const {
+        size_t emplacement = trouverEmplacement(patientId);
+        return emplacement != AUCUN_EMPLACEMENT ? &emplacements[emplacement] : nullptr;
     }
 
     /**
-     * Récupère tous les patients qui peuvent sortir
+     * Heure de sortie prévue la plus proche (0 si la salle est vide)
      */
-    std::vector<Patient*> getPatientsPretsASortir() {
-        std::vector<Patient*> patientsPrets;
+    time_t getProchaineSortie() const {
+        return tasSorties.estVide() ? 0 : tasSorties.getCleMinimum();
+    }
 
-        for (const auto& pr : patientsEnReveil) {
-            if (pr.peutSortir() && pr.patient) {
-                patientsPrets.push_back(pr.patient);
-            }
+    /**
+     * Patients présents, par ordre d'entrée (copie, pour l'affichage)
+     */
+    std::vector<const PatientReveil*> getPatientsEnReveil() const {
+        std::vector<const PatientReveil*> presents;
+        presents.reserve(static_cast<size_t>(nombrePatients));
+        for (const auto& entree : emplacements) {
+            if (entree.patient) presents.push_back(&entree);
         }
+        std::sort(presents.begin(), presents.end(), [](const PatientReveil* a, const PatientReveil* b) {
+            return a->horodatageEntree != b->horodatageEntree ? a->horodatageEntree < b->horodatageEntree
+                                                              : a->patient->getId() < b->patient->getId();
+        });
+        return presents;
+    }
 
+    /**
+     * Récupère tous les patients qui peuvent sortir
+     */
+    std::vector<Patient*> getPatientsPretsASortir(time_t maintenant) const {
+        std::vector<Patient*> patientsPrets;
+        tasSorties.parcourirJusqua(maintenant, [&](size_t emplacement) {
+            patientsPrets.push_back(emplacements[emplacement].patient);
+        });
         return patientsPrets;
     }
 
     /**
-     * Retire tous les patients qui ont terminé leur réveil
+     * Retire tous les patients qui ont terminé leur réveil, par heure de sortie prévue
      */
-    std::vector<Patient*> libererPatientsPrets() {
+    std::vector<Patient*> libererPatientsPrets(time_t maintenant) {
         std::vector<Patient*> patientsLiberes;
-
-        auto it = patientsEnReveil.begin();
-        while (it != patientsEnReveil.end()) {
-            if (it->peutSortir()) {
-                patientsLiberes.push_back(it->patient);
-                it = patientsEnReveil.erase(it);
-            } else {
-                ++it;
-            }
+        while (!tasSorties.estVide() && tasSorties.getCleMinimum() <= maintenant) {
+            patientsLiberes.push_back(retirerEmplacement(tasSorties.getMinimum(), maintenant));
         }
-
         return patientsLiberes;
     }
 
     /**
-     * Calcule le temps de réveil moyen en minutes
+     * Compte le nombre de patients prêts à sortir
+     */
+    int compterPatientsPretsASortir(time_t maintenant) const {
+        int nombre = 0;
+        tasSorties.parcourirJusqua(maintenant, [&](size_t) { nombre++; });
+        return nombre;
+    }
+
+    /**
+     * Temps moyen déjà passé en salle par les patients présents (minutes)
      */
-    double getTempsReveilMoyenMinutes() const {
+    double getTempsReveilMoyenMinutes(time_t maintenant) const {
         if (estVide()) {
             return 0.0;
         }
 
-        int totalTempsReveil = 0;
-        for (const auto& pr : patientsEnReveil) {
-            totalTempsReveil += pr.getTempsReveilMinutes();
-        }
+        double totalSecondes = static_cast<double>(maintenant) * nombrePatients
+                             - static_cast<double>(sommeHorodatagesEntree);
+        return totalSecondes / 60.0 / nombrePatients;
+    }
 
-        return static_cast<double>(totalTempsReveil) / patientsEnReveil.size();
+    /**
+     * Durée moyenne des séjours terminés (minutes)
+     */
+    double getDureeSejourMoyenneMinutes() const {
+        return nombreSorties > 0 ? static_cast<double>(sommeSejoursSecondes) / 60.0 / nombreSorties : 0.0;
     }
 
     /**
-     * Calcule le taux d'occupation (%)
+     * Calcule le taux d'occupation instantané (%)
      */
     double getTauxOccupation() const {
         if (capaciteMax == 0) {
             return 0.0;
         }
-        return (static_cast<double>(patientsEnReveil.size()) / capaciteMax) * 100.0;
+        return (static_cast<double>(nombrePatients) / capaciteMax) * 100.0;
     }
 
     /**
-     * Compte le nombre de patients prêts à sortir
+     * Taux d'occupation moyen depuis la première entrée jusqu'à maintenant (%)
      */
-    int compterPatientsPretsASortir() const {
-        return std::count_if(patientsEnReveil.begin(), patientsEnReveil.end(),
-            [](const PatientReveil& pr) { return pr.peutSortir(); });
+    double getTauxOccupationMoyen(time_t maintenant) const {
+        if (capaciteMax == 0 || horodatageOuverture == 0 || maintenant <= horodatageOuverture) {
+            return getTauxOccupation();
+        }
+        int64_t occupation = occupationCumuleeSecondes;
+        if (maintenant > horodatageDernierChangement) {
+            occupation += static_cast<int64_t>(nombrePatients) * (maintenant - horodatageDernierChangement);
+        }
+        return static_cast<double>(occupation) / (static_cast<double>(maintenant - horodatageOuverture) * capaciteMax)
+               * 100.0;
     }
 
     /**
      * Vide complètement la salle de réveil
      */
     void vider() {
-        patientsEnReveil.clear();
+        emplacements.clear();
+        emplacementsLibres.clear();
+        emplacementParId.clear();
+        tasSorties.vider();
+        nombrePatients = 0;
+        sommeHorodatagesEntree = 0;
+        horodatageOuverture = 0;
+        horodatageDernierChangement = 0;
+        occupationCumuleeSecondes = 0;
+        nombreSorties = 0;
+        sommeSejoursSecondes = 0;
     }
 
     /**
      * Conversion vers JSON pour l'API
      */
-    nlohmann::json toJson() const {
+    nlohmann::json toJson(time_t maintenant) const {
         nlohmann::json patientsJson = nlohmann::json::array();
-        for (const auto& pr : patientsEnReveil) {
-            patientsJson.push_back(pr.toJson());
+        for (const PatientReveil* pr : getPatientsEnReveil()) {
+            patientsJson.push_back(pr->toJson(maintenant));
         }
 
+        nlohmann::json json = getResumeJson(maintenant);
+        json["patientsEnReveil"] = patientsJson;
+        return json;
+    }
+
+    /**
+     * Résumé de la salle sans la liste des patients
+     */
+    nlohmann::json getResumeJson(time_t maintenant) const {
         return nlohmann::json{
             {"id", id},
             {"nom", nom},
@@ -235,22 +368,25 @@ public:
             {"dureeReveilDefaultMinutes", dureeReveilDefaultMinutes},
             {"estPleine", estPleine()},
             {"estVide", estVide()},
-            {"patientsEnReveil", patientsJson},
-            {"tempsReveilMoyenMinutes", getTempsReveilMoyenMinutes()},
+            {"tempsReveilMoyenMinutes", getTempsReveilMoyenMinutes(maintenant)},
+            {"dureeSejourMoyenneMinutes", getDureeSejourMoyenneMinutes()},
+            {"nombreSorties", nombreSorties},
             {"tauxOccupation", getTauxOccupation()},
-            {"nombrePatientsPretsASortir", compterPatientsPretsASortir()}
+            {"tauxOccupationMoyen", getTauxOccupationMoyen(maintenant)},
+            {"prochaineSortie", getProchaineSortie()},
+            {"nombrePatientsPretsASortir", compterPatientsPretsASortir(maintenant)}
         };
     }
 
     /**
      * Conversion vers string pour debug
      */
-    std::string toString() const {
+    std::string toString(time_t maintenant) const {
         std::ostringstream oss;
         oss << "SalleReveil #" << id << ": " << nom
             << " | Patients: " << getNombrePatients() << "/" << capaciteMax
             << " | Taux occupation: " << getTauxOccupation() << "%"
-            << " | Prêts à sortir: " << compterPatientsPretsASortir();
+            << " | Prêts à sortir: " << compterPatientsPretsASortir(maintenant);
         return oss.str();
     }
 };
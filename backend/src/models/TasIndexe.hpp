@@ -0,0 +1,139 @@
+#ifndef TAS_INDEXE_HPP
+#define TAS_INDEXE_HPP
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace AutoMed {
+
+/**
+ * Tas binaire (minimum) indexé sur des emplacements entiers
+ *
+ * Chaque emplacement connaît sa position dans le tas: insertion, retrait
+ * du minimum et retrait d'un emplacement quelconque en O(log n). La clé est
+ * copiée dans le tas pour que les comparaisons restent locales en mémoire.
+ */
+template <typename Cle>
+class TasIndexe {
+private:
+    struct Noeud {
+        Cle cle;
+        size_t emplacement;
+    };
+
+    static constexpr size_t ABSENT = static_cast<size_t>(-1);
+
+    std::vector<Noeud> noeuds;
+    std::vector<size_t> positions;  // Emplacement -> position dans noeuds (ABSENT si hors du tas)
+
+    void placer(size_t position, const Noeud& noeud) {
+        noeuds[position] = noeud;
+        positions[noeud.emplacement] = position;
+    }
+
+    void monter(size_t position) {
+        Noeud noeud = noeuds[position];
+        while (position > 0) {
+            size_t parent = (position - 1) / 2;
+            if (!(noeud.cle < noeuds[parent].cle)) break;
+            placer(position, noeuds[parent]);
+            position = parent;
+        }
+        placer(position, noeud);
+    }
+
+    void descendre(size_t position) {
+        Noeud noeud = noeuds[position];
+        size_t taille = noeuds.size();
+        while (true) {
+            size_t enfant = 2 * position + 1;
+            if (enfant >= taille) break;
+            if (enfant + 1 < taille && noeuds[enfant + 1].cle < noeuds[enfant].cle) enfant++;
+            if (!(noeuds[enfant].cle < noeud.cle)) break;
+            placer(position, noeuds[enfant]);
+            position = enfant;
+        }
+        placer(position, noeud);
+    }
+
+    template <typename Fonction>
+    void parcourirDepuis(size_t position, const Cle& borne, Fonction& fonction) const {
+        if (position >= noeuds.size() || borne < noeuds[position].cle) return;
+        fonction(noeuds[position].emplacement);
+        parcourirDepuis(2 * position + 1, borne, fonction);
+        parcourirDepuis(2 * position + 2, borne, fonction);
+    }
+
+public:
+    bool estVide() const { return noeuds.empty(); }
+    size_t getTaille() const { return noeuds.size(); }
+
+    bool contient(size_t emplacement) const {
+        return emplacement < positions.size() && positions[emplacement] != ABSENT;
+    }
+
+    /**
+     * Insère un emplacement absent du tas
+     */
+    void inserer(size_t emplacement, const Cle& cle) {
+        if (emplacement >= positions.size()) {
+            positions.resize(emplacement + 1, ABSENT);
+        }
+        noeuds.push_back(Noeud{cle, emplacement});
+        monter(noeuds.size() - 1);
+    }
+
+    /**
+     * Emplacement de clé minimale (tas non vide)
+     */
+    size_t getMinimum() const { return noeuds.front().emplacement; }
+    const Cle& getCleMinimum() const { return noeuds.front().cle; }
+
+    /**
+     * Appelle fonction(emplacement) pour chaque clé ≤ borne, sans ordre
+     * particulier: seuls ces nœuds et leurs enfants directs sont visités
+     */
+    template <typename Fonction>
+    void parcourirJusqua(const Cle& borne, Fonction fonction) const {
+        parcourirDepuis(0, borne, fonction);
+    }
+
+    /**
+     * Retire un emplacement où qu'il soit dans le tas (sans effet s'il est absent)
+     */
+    void retirer(size_t emplacement) {
+        if (!contient(emplacement)) return;
+
+        size_t position = positions[emplacement];
+        positions[emplacement] = ABSENT;
+
+        Noeud dernier = noeuds.back();
+        noeuds.pop_back();
+        if (position == noeuds.size()) return;
+
+        placer(position, dernier);
+        if (position > 0 && dernier.cle < noeuds[(position - 1) / 2].cle) {
+            monter(position);
+        } else {
+            descendre(position);
+        }
+    }
+
+    /**
+     * Prépare la place de nombre emplacements (pas de réallocation en dessous)
+     */
+    void reserver(size_t nombre) {
+        noeuds.reserve(nombre);
+        positions.reserve(nombre);
+    }
+
+    void vider() {
+        noeuds.clear();
+        positions.clear();
+    }
+};
+
+} // namespace AutoMed
+
+#endif // TAS_INDEXE_HPP
@@ -109,17 +109,32 @@ public:
                 config.algorithme = stringToAlgorithme(body.value("algorithme", "FCFS"));
                 config.nombreBlocs = body.value("nombreBlocs", 3);
                 config.nombreEquipes = body.value("nombreEquipes", 3);
+                config.nombreEquipesSpecialisees = body.value("nombreEquipesSpecialisees", 0);
                 config.capaciteSalleAttente = body.value("capaciteSalleAttente", 50);
                 config.capaciteSalleReveil = body.value("capaciteSalleReveil", 20);
                 config.tauxArriveeHoraireUrgences = body.value("tauxArriveeHoraireUrgences", 2.0);
                 config.nombrePatientsElectifs = body.value("nombrePatientsElectifs", 10);
                 config.facteurVitesse = body.value("facteurVitesse", 0.0);
+                config.modeCalendrier = stringToModeCalendrier(body.value("modeCalendrier", "TAS_BINAIRE"));
+                // Sans graine fournie, chaque simulation est différente (la graine est renvoyée pour la rejouer)
+                config.graine = body.value("graine", static_cast<uint64_t>(std::time(nullptr)));
+                config.identifiantFlux = body.value("identifiantFlux", static_cast<uint64_t>(0));
+                config.niveauJournal = stringToNiveauJournal(body.value("niveauJournal", "INFO"));
+                config.tailleHistorique = body.value("tailleHistorique", 50);
+                config.horizonAnticipationMinutes = body.value("horizonAnticipationMinutes", 120);
+                config.budgetDecisionMicrosecondes = body.value("budgetDecisionMicrosecondes", 500);
+                config.mesurerDecisions = body.value("mesurerDecisions", false);
+                config.preemptionUrgences = body.value("preemptionUrgences", false);
+                config.dureePreparationMinutes = body.value("dureePreparationMinutes", 15);
+                config.reserveUrgencesMax = body.value("reserveUrgencesMax", 1);
+                config.fenetreReserveMinutes = body.value("fenetreReserveMinutes", 60);
                 
                 int simId = simulationManager->creerSimulation(config);
                 
                 json response = {
                     {"success", true},
                     {"simulationId", simId},
+                    {"graine", config.graine},
                     {"message", "Simulation créée avec succès"}
                 };
                 crow::response res(200, response.dump());
@@ -272,7 +287,7 @@ public:
         
         // GET /api/simulation/<id>/events - Derniers événements
         CROW_ROUTE(app, "/api/simulation/<int>/events")
-        ([this](int simId) {
+        ([this](const crow::request& req, int simId) {
             SimulationEngine* sim = simulationManager->getSimulation(simId);
             if (!sim) {
                 json error = {
@@ -284,7 +299,17 @@ public:
                 return res;
             }
             
-            auto eventsData = sim->getEvenements();
+            // ?depuis=N: seulement les événements traités après le numéro N
+            uint64_t depuis = 0;
+            if (const char* parametre = req.url_params.get("depuis")) {
+                try {
+                    depuis = std::stoull(parametre);
+                } catch (const std::exception&) {
+                    depuis = 0;
+                }
+            }
+            
+            auto eventsData = sim->getEvenements(depuis);
             json eventsArray = json::array();
             
             // Enrichir chaque événement avec une description lisible
@@ -328,9 +353,48 @@ public:
             json response = {
                 {"simulationId", simId},
                 {"events", eventsArray},
-                {"count", eventsArray.size()}
+                {"count", eventsArray.size()},
+                {"dernierNumero", eventsData["dernierNumero"]},
+                {"tronque", eventsData["tronque"]}
+            };
+            
+            crow::response res(200, response.dump());
+            addCORSHeaders(res);
+            return res;
+        });
+        
+        // GET /api/simulation/<id>/series - Indicateurs minute par minute sur une plage
+        // ?debut=&fin= (minutes depuis le début), ?resolution=1|15|60|1440, ?points= (si pas de résolution)
+        CROW_ROUTE(app, "/api/simulation/<int>/series")
+        ([this](const crow::request& req, int simId) {
+            SimulationEngine* sim = simulationManager->getSimulation(simId);
+            if (!sim) {
+                json error = {
+                    {"success", false},
+                    {"error", "Simulation non trouvée"}
+                };
+                crow::response res(404, error.dump());
+                addCORSHeaders(res);
+                return res;
+            }
+            
+            auto lireEntier = [&req](const char* nom, int64_t defaut) {
+                if (const char* parametre = req.url_params.get(nom)) {
+                    try {
+                        return static_cast<int64_t>(std::stoll(parametre));
+                    } catch (const std::exception&) {
+                        return defaut;
+                    }
+                }
+                return defaut;
             };
             
+            json response = sim->getSeries(
+                lireEntier("debut", 0),
+                lireEntier("fin", -1),
+                lireEntier("resolution", 0),
+                static_cast<size_t>(std::max<int64_t>(1, lireEntier("points", 1000)))
+            );
             crow::response res(200, response.dump());
             addCORSHeaders(res);
             return res;
@@ -391,7 +455,9 @@ public:
         std::cout << "    POST   /api/simulation/<id>/stop" << std::endl;
         std::cout << "    GET    /api/simulation/<id>/status" << std::endl;
         std::cout << "    GET    /api/simulation/<id>/stats" << std::endl;
-        std::cout << "    GET    /api/simulation/<id>/events" << std::endl;
+        std::cout << "    GET    /api/simulation/<id>/events?depuis=N" << std::endl;
+        std::cout << "           (numéro > N seulement; réponse: dernierNumero, tronque)" << std::endl;
+        std::cout << "    GET    /api/simulation/<id>/series?debut=&fin=&resolution=&points=" << std::endl;
         std::cout << "    GET    /api/simulations" << std::endl;
         std::cout << "    DELETE /api/simulation/<id>" << std::endl;
         std::cout << "========================================" << std::endl;
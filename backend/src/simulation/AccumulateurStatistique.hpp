@@ -0,0 +1,180 @@
+#ifndef ACCUMULATEUR_STATISTIQUE_HPP
+#define ACCUMULATEUR_STATISTIQUE_HPP
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+#include <nlohmann/json.hpp>
+
+namespace AutoMed {
+
+/**
+ * Esquisse de quantiles à précision relative garantie (DDSketch)
+ *
+ * Une valeur v ≥ 1 tombe dans la case ceil(log(v) / log(γ)), avec
+ * γ = (1 + α) / (1 - α): tout quantile renvoyé est à moins de α (1 %) de la
+ * vraie valeur en relatif. Les valeurs < 1 (0 minute) ont leur propre
+ * compteur. Les cases sont contiguës à partir de la clé 0 et ne grandissent
+ * qu'avec le logarithme du maximum; au-delà de NOMBRE_MAX_CASES, la dernière
+ * case absorbe les valeurs (mémoire bornée quelle que soit la durée simulée).
+ */
+class EsquisseQuantiles {
+public:
+    static constexpr double PRECISION_RELATIVE = 0.01;
+    static constexpr size_t NOMBRE_MAX_CASES = 2048;    // γ^2048 ≈ 6·10^17
+    static constexpr int64_t NOMBRE_CLES_PRECALCULEES = 4096;   // Minutes entières < 4096: sans logarithme
+
+private:
+    std::vector<uint64_t> cases;    // Indice = clé
+    uint64_t nombreSousUn;          // Valeurs < 1
+    uint64_t nombre;
+
+    static double getGamma() { return (1.0 + PRECISION_RELATIVE) / (1.0 - PRECISION_RELATIVE); }
+    static double getLogGamma() {
+        static const double logGamma = std::log(getGamma());
+        return logGamma;
+    }
+
+    static size_t calculerCle(double valeur) {
+        size_t cle = static_cast<size_t>(std::ceil(std::log(valeur) / getLogGamma()));
+        return std::min(cle, NOMBRE_MAX_CASES - 1);
+    }
+
+    /**
+     * Clés des petites valeurs entières, calculées une fois par processus
+     */
+    static const std::array<uint16_t, NOMBRE_CLES_PRECALCULEES>& getClesPrecalculees() {
+        static const std::array<uint16_t, NOMBRE_CLES_PRECALCULEES> cles = [] {
+            std::array<uint16_t, NOMBRE_CLES_PRECALCULEES> table{};
+            for (int64_t v = 1; v < NOMBRE_CLES_PRECALCULEES; v++) {
+                table[v] = static_cast<uint16_t>(calculerCle(static_cast<double>(v)));
+            }
+            return table;
+        }();
+        return cles;
+    }
+
+    void incrementer(size_t cle) {
+        if (cle >= cases.size()) cases.resize(cle + 1, 0);
+        cases[cle]++;
+    }
+
+public:
+    EsquisseQuantiles() : nombreSousUn(0), nombre(0) {}
+
+    void ajouter(double valeur) {
+        nombre++;
+        if (!(valeur >= 1.0)) {
+            nombreSousUn++;
+            return;
+        }
+        incrementer(calculerCle(valeur));
+    }
+
+    void ajouter(int64_t valeur) {
+        if (valeur >= 1 && valeur < NOMBRE_CLES_PRECALCULEES) {
+            nombre++;
+            incrementer(getClesPrecalculees()[static_cast<size_t>(valeur)]);
+        } else {
+            ajouter(static_cast<double>(valeur));
+        }
+    }
+
+    /**
+     * Quantile q ∈ [0, 1] (0 si vide): milieu de la case du rang q·(n - 1)
+     */
+    double getQuantile(double q) const {
+        if (nombre == 0) return 0.0;
+
+        uint64_t rang = static_cast<uint64_t>(std::clamp(q, 0.0, 1.0) * (nombre - 1));
+        uint64_t cumul = nombreSousUn;
+        if (rang < cumul) return 0.0;
+
+        for (size_t cle = 0; cle < cases.size(); cle++) {
+            cumul += cases[cle];
+            if (rang < cumul) {
+                return cle == 0 ? 1.0 : 2.0 * std::pow(getGamma(), static_cast<double>(cle)) / (getGamma() + 1.0);
+            }
+        }
+        return 2.0 * std::pow(getGamma(), static_cast<double>(cases.size() - 1)) / (getGamma() + 1.0);
+    }
+
+    uint64_t getNombre() const { return nombre; }
+    size_t getNombreCases() const { return cases.size(); }
+};
+
+/**
+ * Accumulateur en flux d'une mesure (minutes entières)
+ *
+ * Mémoire constante et requêtes en O(1): nombre, somme exacte, minimum,
+ * maximum, variance par l'algorithme de Welford et quantiles approchés par
+ * EsquisseQuantiles. La moyenne publiée est somme / nombre, exacte (comme
+ * l'ancienne moyenne des vecteurs par patient); la moyenne de Welford ne
+ * sert qu'à la variance, numériquement stable sur de longues simulations.
+ */
+class AccumulateurStatistique {
+private:
+    uint64_t nombre;
+    int64_t somme;
+    int64_t minimum;
+    int64_t maximum;
+    double moyenneWelford;
+    double m2;                      // Somme des carrés des écarts à la moyenne
+    EsquisseQuantiles quantiles;
+
+public:
+    AccumulateurStatistique()
+        : nombre(0), somme(0), minimum(0), maximum(0), moyenneWelford(0.0), m2(0.0) {}
+
+    void ajouter(int64_t valeur) {
+        nombre++;
+        somme += valeur;
+        minimum = (nombre == 1) ? valeur : std::min(minimum, valeur);
+        maximum = (nombre == 1) ? valeur : std::max(maximum, valeur);
+
+        double ecart = static_cast<double>(valeur) - moyenneWelford;
+        moyenneWelford += ecart / static_cast<double>(nombre);
+        m2 += ecart * (static_cast<double>(valeur) - moyenneWelford);
+
+        quantiles.ajouter(valeur);
+    }
+
+    uint64_t getNombre() const { return nombre; }
+    int64_t getSomme() const { return somme; }
+    int64_t getMin() const { return minimum; }
+    int64_t getMax() const { return maximum; }
+
+    double getMoyenne() const {
+        return nombre > 0 ? static_cast<double>(somme) / nombre : 0.0;
+    }
+
+    /**
+     * Variance de l'échantillon (n - 1)
+     */
+    double getVariance() const {
+        return nombre > 1 ? m2 / static_cast<double>(nombre - 1) : 0.0;
+    }
+
+    double getEcartType() const { return std::sqrt(getVariance()); }
+    double getQuantile(double q) const { return quantiles.getQuantile(q); }
+    const EsquisseQuantiles& getQuantiles() const { return quantiles; }
+
+    nlohmann::json toJson() const {
+        return nlohmann::json{
+            {"nombre", nombre},
+            {"moyenne", getMoyenne()},
+            {"ecartType", getEcartType()},
+            {"min", minimum},
+            {"max", maximum},
+            {"p50", getQuantile(0.50)},
+            {"p90", getQuantile(0.90)},
+            {"p99", getQuantile(0.99)}
+        };
+    }
+};
+
+} // namespace AutoMed
+
+#endif // ACCUMULATEUR_STATISTIQUE_HPP
@@ -0,0 +1,141 @@
+#ifndef ARENA_SIMULATION_HPP
+#define ARENA_SIMULATION_HPP
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace AutoMed {
+
+/**
+ * Arène monotone d'une simulation
+ *
+ * Les objets d'une simulation (patients, membres, équipes, blocs, salles,
+ * générateur, statistiques) sont construits les uns à la suite des autres
+ * dans de grands blocs de mémoire et ne sont jamais libérés un par un.
+ * reinitialiser() appelle les destructeurs (ordre inverse de création) et
+ * garde la mémoire, regroupée en un seul bloc: un moteur réutilisé ne fait
+ * plus d'allocation pour son graphe d'objets.
+ */
+class ArenaSimulation {
+public:
+    static constexpr size_t TAILLE_BLOC_INITIALE = 64 * 1024;
+
+private:
+    struct Bloc {
+        unsigned char* donnees;
+        size_t taille;
+    };
+
+    struct Destruction {
+        void* objet;
+        void (*detruire)(void*);
+    };
+
+    std::vector<Bloc> blocs;
+    size_t blocCourant;
+    size_t position;                        // Premier octet libre du bloc courant
+    size_t octetsUtilises;
+    std::vector<Destruction> destructions;  // Objets à détruire, dans l'ordre de création
+    size_t nombreAllocationsSysteme;        // Blocs demandés au système depuis la création
+
+    /**
+     * Réserve taille octets alignés (les blocs sont alignés sur max_align_t)
+     */
+    void* allouer(size_t taille, size_t alignement) {
+        while (blocCourant < blocs.size()) {
+            size_t debut = (position + alignement - 1) & ~(alignement - 1);
+            if (debut + taille <= blocs[blocCourant].taille) {
+                position = debut + taille;
+                octetsUtilises += taille;
+                return blocs[blocCourant].donnees + debut;
+            }
+            blocCourant++;
+            position = 0;
+        }
+
+        // Nouveau bloc: au moins le double du précédent
+        size_t tailleBloc = blocs.empty() ? TAILLE_BLOC_INITIALE : blocs.back().taille * 2;
+        if (tailleBloc < taille) tailleBloc = taille;
+        blocs.push_back(Bloc{new unsigned char[tailleBloc], tailleBloc});
+        nombreAllocationsSysteme++;
+
+        blocCourant = blocs.size() - 1;
+        position = taille;
+        octetsUtilises += taille;
+        return blocs[blocCourant].donnees;
+    }
+
+    void detruireObjets() {
+        for (size_t i = destructions.size(); i > 0; i--) {
+            destructions[i - 1].detruire(destructions[i - 1].objet);
+        }
+        destructions.clear();
+    }
+
+public:
+    ArenaSimulation()
+        : blocCourant(0), position(0), octetsUtilises(0), nombreAllocationsSysteme(0) {}
+
+    ~ArenaSimulation() {
+        detruireObjets();
+        for (auto& bloc : blocs) delete[] bloc.donnees;
+    }
+
+    ArenaSimulation(const ArenaSimulation&) = delete;
+    ArenaSimulation& operator=(const ArenaSimulation&) = delete;
+
+    /**
+     * Construit un objet dans l'arène; il vit jusqu'au prochain reinitialiser()
+     */
+    template <typename T, typename... Arguments>
+    T* creer(Arguments&&... arguments) {
+        static_assert(alignof(T) <= alignof(std::max_align_t), "Alignement non supporté par l'arène");
+
+        void* memoire = allouer(sizeof(T), alignof(T));
+        T* objet = new (memoire) T(std::forward<Arguments>(arguments)...);
+        if (!std::is_trivially_destructible<T>::value) {
+            destructions.push_back(Destruction{objet, [](void* p) { static_cast<T*>(p)->~T(); }});
+        }
+        return objet;
+    }
+
+    /**
+     * Détruit tous les objets et rend l'arène vide. Plusieurs blocs sont
+     * remplacés par un seul de leur taille totale (taille atteinte par la
+     * simulation précédente)
+     */
+    void reinitialiser() {
+        detruireObjets();
+
+        if (blocs.size() > 1) {
+            size_t total = 0;
+            for (auto& bloc : blocs) {
+                total += bloc.taille;
+                delete[] bloc.donnees;
+            }
+            blocs.clear();
+            blocs.push_back(Bloc{new unsigned char[total], total});
+            nombreAllocationsSysteme++;
+        }
+
+        blocCourant = 0;
+        position = 0;
+        octetsUtilises = 0;
+    }
+
+    size_t getOctetsUtilises() const { return octetsUtilises; }
+    size_t getNombreAllocationsSysteme() const { return nombreAllocationsSysteme; }
+
+    size_t getOctetsReserves() const {
+        size_t total = 0;
+        for (const auto& bloc : blocs) total += bloc.taille;
+        return total;
+    }
+};
+
+} // namespace AutoMed
+
+#endif // ARENA_SIMULATION_HPP
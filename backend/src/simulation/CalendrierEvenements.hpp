@@ -0,0 +1,565 @@
+#ifndef CALENDRIER_EVENEMENTS_HPP
+#define CALENDRIER_EVENEMENTS_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <ctime>
+#include <vector>
+#include "Evenement.hpp"
+#include "../enums/ModeCalendrier.hpp"
+
+namespace AutoMed {
+
+/**
+ * Enregistrement compact d'un événement planifié
+ * POD sans métadonnées: c'est ce qui circule dans le calendrier
+ */
+struct EvenementPlanifie {
+    time_t horodatage;              // Quand l'événement se produit (timestamp)
+    uint64_t sequence;              // Ordre de planification (départage des ex-aequo)
+    TypeEvenement type;
+    int patientId;                  // -1 si non applicable
+    int blocOperatoireId;           // -1 si non applicable
+    int equipeId;                   // -1 si non applicable
+
+    /**
+     * Construit la vue complète (métadonnées vides, construites à la demande)
+     */
+    Evenement versEvenement() const {
+        return Evenement(type, horodatage, patientId, blocOperatoireId, equipeId, sequence);
+    }
+};
+
+/**
+ * Poignée d'un événement planifié: emplacement dans le pool et génération
+ * de l'emplacement (une poignée d'événement déjà traité ou annulé est périmée)
+ */
+struct PoigneeEvenement {
+    uint32_t emplacement = 0;
+    uint32_t generation = 0;        // 0: aucune poignée
+
+    bool estValide() const { return generation != 0; }
+};
+
+/**
+ * Calendrier d'événements à base d'un pool d'enregistrements
+ *
+ * Les événements vivent dans un slab réutilisé (liste libre), les structures
+ * d'ordonnancement ne manipulent que des poignées 32 bits.
+ * Ordre total: horodatage, rang du type (rangTypeEvenement), puis ordre
+ * de planification. Il ne dépend donc pas de la structure utilisée.
+ *
+ * Deux structures au choix, qui produisent exactement le même ordre:
+ *  - TAS_BINAIRE: tas binaire de poignées
+ *  - ROUE_TEMPORELLE: une alvéole par minute virtuelle sur TAILLE_ROUE minutes,
+ *    les événements au-delà de l'horizon attendent dans le tas (débordement)
+ *    et sont migrés dans la roue quand le curseur avance
+ *
+ * Annulation et replanification par poignée: chaque emplacement connaît sa
+ * position dans le tas, d'où un retrait ou un déplacement en O(log n). Un
+ * événement déjà rangé dans une alvéole est marqué annulé et libéré quand le
+ * curseur l'atteint; quand les annulés dépassent la moitié de la roue, les
+ * alvéoles sont compactées.
+ */
+class CalendrierEvenements {
+public:
+    static const int64_t TAILLE_ROUE = 4096;   // Minutes couvertes par la roue (puissance de 2)
+    static const size_t SEUIL_COMPACTAGE = 64;  // Annulés dans la roue avant d'envisager un compactage
+
+private:
+    /**
+     * Alvéole de la roue: poignées triées, consommées depuis la tête
+     */
+    struct Alveole {
+        std::vector<uint32_t> poignees;
+        size_t tete = 0;
+
+        bool estVide() const { return tete == poignees.size(); }
+    };
+
+    static constexpr uint32_t POSITION_ABSENTE = UINT32_MAX;        // Emplacement libre
+    static constexpr uint32_t POSITION_ROUE = UINT32_MAX - 1;       // Rangé dans une alvéole
+    static constexpr uint32_t POSITION_ANNULEE = UINT32_MAX - 2;    // Annulé, encore dans une alvéole
+
+    ModeCalendrier mode;
+    std::vector<EvenementPlanifie> pool;     // Slab des enregistrements
+    std::vector<uint32_t> generations;       // Génération courante de chaque emplacement
+    std::vector<uint32_t> positions;         // Position dans le tas (ou POSITION_*)
+    std::vector<uint32_t> emplacementsLibres; // Indices réutilisables du slab
+    std::vector<uint32_t> tas;               // Tas binaire (ou débordement de la roue)
+    uint64_t prochaineSequence;
+    size_t taille;
+
+    // Roue temporelle
+    std::vector<Alveole> alveoles;
+    std::vector<uint64_t> alveolesOccupees;  // Bitmap des alvéoles non vides
+    time_t origine;                          // Minute 0 de la roue
+    bool origineDefinie;
+    int64_t minuteCourante;                  // Minute du dernier événement extrait
+    size_t nombreDansRoue;                   // Annulés compris
+    size_t nombreAnnulesRoue;                // Annulés encore dans une alvéole
+
+    // Compteurs (remis à zéro par vider)
+    uint64_t nombreAnnulations;
+    uint64_t nombreReplanifications;
+    uint64_t nombreCompactages;
+
+    /**
+     * Vrai si l'événement a doit être traité avant b
+     */
+    bool avant(uint32_t a, uint32_t b) const {
+        const EvenementPlanifie& ea = pool[a];
+        const EvenementPlanifie& eb = pool[b];
+        if (ea.horodatage != eb.horodatage) return ea.horodatage < eb.horodatage;
+        int rangA = rangTypeEvenement(ea.type);
+        int rangB = rangTypeEvenement(eb.type);
+        if (rangA != rangB) return rangA < rangB;
+        return ea.sequence < eb.sequence;
+    }
+
+    void placer(size_t pos, uint32_t poignee) {
+        tas[pos] = poignee;
+        positions[poignee] = static_cast<uint32_t>(pos);
+    }
+
+    void remonter(size_t pos) {
+        uint32_t poignee = tas[pos];
+        while (pos > 0) {
+            size_t parent = (pos - 1) / 2;
+            if (!avant(poignee, tas[parent])) break;
+            placer(pos, tas[parent]);
+            pos = parent;
+        }
+        placer(pos, poignee);
+    }
+
+    void descendre(size_t pos) {
+        uint32_t poignee = tas[pos];
+        size_t n = tas.size();
+        while (true) {
+            size_t enfant = 2 * pos + 1;
+            if (enfant >= n) break;
+            if (enfant + 1 < n && avant(tas[enfant + 1], tas[enfant])) enfant++;
+            if (!avant(tas[enfant], poignee)) break;
+            placer(pos, tas[enfant]);
+            pos = enfant;
+        }
+        placer(pos, poignee);
+    }
+
+    void insererTas(uint32_t poignee) {
+        tas.push_back(poignee);
+        remonter(tas.size() - 1);
+    }
+
+    uint32_t retirerSommetTas() {
+        uint32_t poignee = tas.front();
+        retirerTas(0);
+        return poignee;
+    }
+
+    /**
+     * Retire la poignée à une position quelconque du tas
+     */
+    void retirerTas(size_t pos) {
+        positions[tas[pos]] = POSITION_ABSENTE;
+        uint32_t derniere = tas.back();
+        tas.pop_back();
+        if (pos == tas.size()) return;
+
+        placer(pos, derniere);
+        if (pos > 0 && avant(derniere, tas[(pos - 1) / 2])) {
+            remonter(pos);
+        } else {
+            descendre(pos);
+        }
+    }
+
+    /**
+     * Rend un emplacement au slab: ses poignées deviennent périmées
+     */
+    void liberer(uint32_t poignee) {
+        positions[poignee] = POSITION_ABSENTE;
+        if (++generations[poignee] == 0) generations[poignee] = 1;
+        emplacementsLibres.push_back(poignee);
+    }
+
+    /**
+     * Minute virtuelle d'un horodatage (division entière par défaut)
+     */
+    int64_t minuteDe(time_t horodatage) const {
+        int64_t delta = static_cast<int64_t>(horodatage - origine);
+        int64_t minute = delta / 60;
+        if (delta % 60 < 0) minute--;
+        return minute;
+    }
+
+    /**
+     * Range une poignée dans l'alvéole de sa minute (insertion triée)
+     */
+    void insererRoue(uint32_t poignee, int64_t minute) {
+        size_t indice = static_cast<size_t>(minute & (TAILLE_ROUE - 1));
+        Alveole& alveole = alveoles[indice];
+        alveole.poignees.push_back(poignee);
+
+        // Le plus souvent déjà en ordre: on remonte depuis la fin
+        size_t pos = alveole.poignees.size() - 1;
+        while (pos > alveole.tete && avant(poignee, alveole.poignees[pos - 1])) {
+            alveole.poignees[pos] = alveole.poignees[pos - 1];
+            pos--;
+        }
+        alveole.poignees[pos] = poignee;
+        positions[poignee] = POSITION_ROUE;
+
+        alveolesOccupees[indice / 64] |= (uint64_t(1) << (indice % 64));
+        nombreDansRoue++;
+    }
+
+    /**
+     * Migre les événements du débordement entrés dans l'horizon de la roue
+     */
+    void migrerDebordement() {
+        while (!tas.empty() && minuteDe(pool[tas.front()].horodatage) < minuteCourante + TAILLE_ROUE) {
+            uint32_t poignee = retirerSommetTas();
+            insererRoue(poignee, minuteDe(pool[poignee].horodatage));
+        }
+    }
+
+    /**
+     * Avance le curseur jusqu'à la prochaine alvéole non vide
+     * Retourne l'indice de cette alvéole
+     */
+    size_t positionnerCurseur() {
+        if (nombreDansRoue == 0) {
+            // Roue vide: sauter directement au premier événement en débordement
+            minuteCourante = minuteDe(pool[tas.front()].horodatage);
+            migrerDebordement();
+        }
+
+        size_t depart = static_cast<size_t>(minuteCourante & (TAILLE_ROUE - 1));
+        size_t nombreMots = alveolesOccupees.size();
+        size_t distance = 0;
+        size_t mot = depart / 64;
+        uint64_t bits = alveolesOccupees[mot] & (~uint64_t(0) << (depart % 64));
+
+        for (size_t parcourus = 0; parcourus <= nombreMots; parcourus++) {
+            if (bits != 0) {
+                size_t indice = mot * 64 + static_cast<size_t>(__builtin_ctzll(bits));
+                distance = (indice + TAILLE_ROUE - depart) & (TAILLE_ROUE - 1);
+                break;
+            }
+            mot = (mot + 1) % nombreMots;
+            bits = alveolesOccupees[mot];
+        }
+
+        if (distance > 0) {
+            minuteCourante += static_cast<int64_t>(distance);
+            migrerDebordement();
+        }
+        return static_cast<size_t>(minuteCourante & (TAILLE_ROUE - 1));
+    }
+
+    /**
+     * Retire la poignée en tête d'une alvéole
+     */
+    uint32_t consommerTete(size_t indice) {
+        Alveole& alveole = alveoles[indice];
+        uint32_t poignee = alveole.poignees[alveole.tete++];
+        if (alveole.estVide()) {
+            alveole.poignees.clear();
+            alveole.tete = 0;
+            alveolesOccupees[indice / 64] &= ~(uint64_t(1) << (indice % 64));
+        }
+        nombreDansRoue--;
+        return poignee;
+    }
+
+    /**
+     * Alvéole du prochain événement non annulé (les annulés rencontrés
+     * en tête sont libérés au passage)
+     */
+    size_t alveoleProchainVivant() {
+        while (true) {
+            size_t indice = positionnerCurseur();
+            const Alveole& alveole = alveoles[indice];
+            if (positions[alveole.poignees[alveole.tete]] != POSITION_ANNULEE) return indice;
+            liberer(consommerTete(indice));
+            nombreAnnulesRoue--;
+        }
+    }
+
+    /**
+     * Retire les annulés de toutes les alvéoles et libère leurs emplacements
+     */
+    void compacterRoue() {
+        for (size_t mot = 0; mot < alveolesOccupees.size(); mot++) {
+            uint64_t bits = alveolesOccupees[mot];
+            while (bits) {
+                size_t indice = mot * 64 + static_cast<size_t>(__builtin_ctzll(bits));
+                bits &= bits - 1;
+
+                Alveole& alveole = alveoles[indice];
+                size_t ecriture = 0;
+                for (size_t lecture = alveole.tete; lecture < alveole.poignees.size(); lecture++) {
+                    uint32_t poignee = alveole.poignees[lecture];
+                    if (positions[poignee] == POSITION_ANNULEE) {
+                        liberer(poignee);
+                        nombreDansRoue--;
+                    } else {
+                        alveole.poignees[ecriture++] = poignee;
+                    }
+                }
+                alveole.poignees.resize(ecriture);
+                alveole.tete = 0;
+                if (ecriture == 0) {
+                    alveolesOccupees[mot] &= ~(uint64_t(1) << (indice % 64));
+                }
+            }
+        }
+        nombreAnnulesRoue = 0;
+        nombreCompactages++;
+    }
+
+    /**
+     * Marque annulé un événement rangé dans une alvéole: la poignée est
+     * périmée dès maintenant, l'emplacement est libéré plus tard
+     */
+    void annulerDansRoue(uint32_t emplacement) {
+        positions[emplacement] = POSITION_ANNULEE;
+        if (++generations[emplacement] == 0) generations[emplacement] = 1;
+        nombreAnnulesRoue++;
+        if (nombreAnnulesRoue > SEUIL_COMPACTAGE && 2 * nombreAnnulesRoue > nombreDansRoue) {
+            compacterRoue();
+        }
+    }
+
+    /**
+     * Range un emplacement déjà rempli: tas, alvéole ou débordement
+     */
+    void ranger(uint32_t poignee) {
+        if (mode == ModeCalendrier::TAS_BINAIRE) {
+            insererTas(poignee);
+            return;
+        }
+
+        time_t horodatage = pool[poignee].horodatage;
+        if (!origineDefinie) {
+            origine = horodatage;
+            origineDefinie = true;
+        }
+
+        // Un événement dans le passé est rangé dans la minute courante
+        int64_t minute = minuteDe(horodatage);
+        if (minute < minuteCourante) minute = minuteCourante;
+
+        if (minute < minuteCourante + TAILLE_ROUE) {
+            insererRoue(poignee, minute);
+        } else {
+            insererTas(poignee);
+        }
+    }
+
+    uint32_t retirerProchainePoignee() {
+        if (mode == ModeCalendrier::TAS_BINAIRE) {
+            return retirerSommetTas();
+        }
+        return consommerTete(alveoleProchainVivant());
+    }
+
+public:
+    /**
+     * Constructeur
+     */
+    explicit CalendrierEvenements(ModeCalendrier mode = ModeCalendrier::TAS_BINAIRE)
+        : mode(mode),
+          prochaineSequence(0),
+          taille(0),
+          origine(0),
+          origineDefinie(false),
+          minuteCourante(0),
+          nombreDansRoue(0),
+          nombreAnnulesRoue(0),
+          nombreAnnulations(0),
+          nombreReplanifications(0),
+          nombreCompactages(0) {
+        if (mode == ModeCalendrier::ROUE_TEMPORELLE) {
+            alveoles.resize(TAILLE_ROUE);
+            alveolesOccupees.assign(TAILLE_ROUE / 64, 0);
+        }
+    }
+
+    /**
+     * Planifie un événement et retourne sa poignée
+     */
+    PoigneeEvenement planifier(TypeEvenement type, time_t horodatage,
+                               int patientId = -1, int blocId = -1, int equipeId = -1) {
+        uint32_t poignee;
+        if (!emplacementsLibres.empty()) {
+            poignee = emplacementsLibres.back();
+            emplacementsLibres.pop_back();
+        } else {
+            poignee = static_cast<uint32_t>(pool.size());
+            pool.emplace_back();
+            generations.push_back(1);
+            positions.push_back(POSITION_ABSENTE);
+        }
+        PoigneeEvenement resultat{poignee, generations[poignee]};
+
+        EvenementPlanifie& evt = pool[poignee];
+        evt.horodatage = horodatage;
+        evt.sequence = prochaineSequence++;
+        evt.type = type;
+        evt.patientId = patientId;
+        evt.blocOperatoireId = blocId;
+        evt.equipeId = equipeId;
+        taille++;
+
+        ranger(poignee);
+        return resultat;
+    }
+
+    /**
+     * Vrai si la poignée désigne un événement encore planifié
+     */
+    bool estPlanifie(PoigneeEvenement poignee) const {
+        return poignee.estValide()
+            && poignee.emplacement < generations.size()
+            && generations[poignee.emplacement] == poignee.generation
+            && positions[poignee.emplacement] != POSITION_ABSENTE
+            && positions[poignee.emplacement] != POSITION_ANNULEE;
+    }
+
+    /**
+     * Annule un événement planifié en O(log n) (sans effet si la poignée est périmée)
+     */
+    bool annuler(PoigneeEvenement poignee) {
+        if (!estPlanifie(poignee)) return false;
+
+        uint32_t emplacement = poignee.emplacement;
+        taille--;
+        nombreAnnulations++;
+        if (positions[emplacement] == POSITION_ROUE) {
+            annulerDansRoue(emplacement);
+            return true;
+        }
+        retirerTas(positions[emplacement]);
+        liberer(emplacement);
+        return true;
+    }
+
+    /**
+     * Déplace un événement planifié à un nouvel horodatage, en O(log n).
+     * L'événement prend un nouveau rang de planification (même ordre qu'une
+     * annulation suivie d'une planification). Retourne la poignée à utiliser
+     * désormais: la même, sauf pour un événement déjà rangé dans une alvéole
+     * (recopié dans un nouvel emplacement). Poignée invalide si périmée.
+     */
+    PoigneeEvenement replanifier(PoigneeEvenement poignee, time_t horodatage) {
+        if (!estPlanifie(poignee)) return PoigneeEvenement();
+        nombreReplanifications++;
+
+        uint32_t emplacement = poignee.emplacement;
+        if (positions[emplacement] == POSITION_ROUE) {
+            EvenementPlanifie evt = pool[emplacement];
+            annulerDansRoue(emplacement);
+            taille--;
+            return planifier(evt.type, horodatage, evt.patientId, evt.blocOperatoireId, evt.equipeId);
+        }
+
+        EvenementPlanifie& evt = pool[emplacement];
+        evt.horodatage = horodatage;
+        evt.sequence = prochaineSequence++;
+        if (mode == ModeCalendrier::TAS_BINAIRE) {
+            size_t pos = positions[emplacement];
+            if (pos > 0 && avant(emplacement, tas[(pos - 1) / 2])) {
+                remonter(pos);
+            } else {
+                descendre(pos);
+            }
+            return poignee;
+        }
+
+        // Débordement de la roue: le nouvel horodatage peut tomber dans l'horizon
+        retirerTas(positions[emplacement]);
+        ranger(emplacement);
+        return poignee;
+    }
+
+    /**
+     * Consulte le prochain événement sans le retirer
+     */
+    const EvenementPlanifie& prochain() {
+        if (mode == ModeCalendrier::TAS_BINAIRE) {
+            return pool[tas.front()];
+        }
+        const Alveole& alveole = alveoles[alveoleProchainVivant()];
+        return pool[alveole.poignees[alveole.tete]];
+    }
+
+    /**
+     * Retire le prochain événement et libère son emplacement
+     */
+    EvenementPlanifie extraire() {
+        uint32_t poignee = retirerProchainePoignee();
+        taille--;
+        liberer(poignee);
+        return pool[poignee];
+    }
+
+    /**
+     * Fixe la minute 0 de la roue (par défaut: premier événement planifié)
+     */
+    void setOrigine(time_t horodatage) {
+        origine = horodatage;
+        origineDefinie = true;
+    }
+
+    /**
+     * Pré-alloue le pool et le tas
+     */
+    void reserver(size_t nombre) {
+        pool.reserve(nombre);
+        generations.reserve(nombre);
+        positions.reserve(nombre);
+        tas.reserve(nombre);
+        emplacementsLibres.reserve(nombre);
+    }
+
+    /**
+     * Vide le calendrier (la mémoire est conservée)
+     */
+    void vider() {
+        pool.clear();
+        generations.clear();
+        positions.clear();
+        emplacementsLibres.clear();
+        tas.clear();
+        prochaineSequence = 0;
+        taille = 0;
+        for (auto& alveole : alveoles) {
+            alveole.poignees.clear();
+            alveole.tete = 0;
+        }
+        std::fill(alveolesOccupees.begin(), alveolesOccupees.end(), 0);
+        origineDefinie = false;
+        minuteCourante = 0;
+        nombreDansRoue = 0;
+        nombreAnnulesRoue = 0;
+        nombreAnnulations = 0;
+        nombreReplanifications = 0;
+        nombreCompactages = 0;
+    }
+
+    bool estVide() const { return taille == 0; }
+    size_t getTaille() const { return taille; }
+    size_t getTaillePool() const { return pool.size(); }
+    size_t getNombreAnnulesEnAttente() const { return nombreAnnulesRoue; }
+    uint64_t getNombreAnnulations() const { return nombreAnnulations; }
+    uint64_t getNombreReplanifications() const { return nombreReplanifications; }
+    uint64_t getNombreCompactages() const { return nombreCompactages; }
+    ModeCalendrier getMode() const { return mode; }
+};
+
+} // namespace AutoMed
+
+#endif // CALENDRIER_EVENEMENTS_HPP
@@ -1,6 +1,7 @@
 #ifndef EVENEMENT_HPP
 #define EVENEMENT_HPP
 
+#include <cstdint>
 #include <ctime>
 #include <string>
 #include <nlohmann/json.hpp>
@@ -36,6 +37,24 @@ inline std::string typeEvenementToString(TypeEvenement type) {
     }
 }
 
+/**
+ * Rang de traitement d'un type d'événement au sein d'une même minute
+ * Les libérations de ressources passent avant les demandes, la fin de
+ * simulation en dernier pour que les événements de la minute soient traités
+ */
+inline int rangTypeEvenement(TypeEvenement type) {
+    switch (type) {
+        case TypeEvenement::SORTIE_SALLE_REVEIL: return 0;
+        case TypeEvenement::FIN_OPERATION: return 1;
+        case TypeEvenement::FIN_NETTOYAGE_BLOC: return 2;
+        case TypeEvenement::ENTREE_SALLE_REVEIL: return 3;
+        case TypeEvenement::DEBUT_OPERATION: return 4;
+        case TypeEvenement::ARRIVEE_PATIENT: return 5;
+        case TypeEvenement::FIN_SIMULATION: return 6;
+        default: return 7;
+    }
+}
+
 /**
  * Représente un événement discret dans la simulation
  */
@@ -45,25 +64,33 @@ struct Evenement {
     int patientId;                  // ID du patient concerné (-1 si non applicable)
     int blocOperatoireId;           // ID du bloc concerné (-1 si non applicable)
     int equipeId;                   // ID de l'équipe concernée (-1 si non applicable)
-    nlohmann::json metadata;        // Données supplémentaires (optionnel)
+    uint64_t sequence;              // Ordre de planification (départage des ex-aequo)
+    uint64_t numero;                // Rang de traitement dans l'historique (0 si non traité)
+    nlohmann::json metadata;        // Données supplémentaires (null tant que non enrichi)
 
     /**
      * Constructeur
      */
-    Evenement(TypeEvenement t, time_t ts, int pId = -1, int bId = -1, int eId = -1)
+    Evenement(TypeEvenement t, time_t ts, int pId = -1, int bId = -1, int eId = -1, uint64_t seq = 0)
         : type(t), 
           horodatage(ts), 
           patientId(pId), 
           blocOperatoireId(bId), 
           equipeId(eId),
-          metadata(nlohmann::json::object()) {}
+          sequence(seq),
+          numero(0) {}
 
     /**
      * Opérateur de comparaison pour priority_queue
+     * Ordre total: horodatage, rang du type, puis séquence de planification
      * Note: Inversion pour avoir un min-heap (événements les plus anciens en premier)
      */
     bool operator<(const Evenement& other) const {
-        return horodatage > other.horodatage;
+        if (horodatage != other.horodatage) return horodatage > other.horodatage;
+        int rang = rangTypeEvenement(type);
+        int rangAutre = rangTypeEvenement(other.type);
+        if (rang != rangAutre) return rang > rangAutre;
+        return sequence > other.sequence;
     }
 
     /**
@@ -85,7 +112,9 @@ struct Evenement {
             {"patientId", patientId},
             {"blocOperatoireId", blocOperatoireId},
             {"equipeId", equipeId},
-            {"metadata", metadata}
+            {"sequence", sequence},
+            {"numero", numero},
+            {"metadata", metadata.is_null() ? nlohmann::json::object() : metadata}
         };
     }
 
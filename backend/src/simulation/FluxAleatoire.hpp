@@ -0,0 +1,161 @@
+#ifndef FLUX_ALEATOIRE_HPP
+#define FLUX_ALEATOIRE_HPP
+
+#include <cstdint>
+#include <cmath>
+#include <limits>
+
+namespace AutoMed {
+
+/**
+ * Sources stochastiques indépendantes du générateur de patients
+ * Chaque source a son propre flux: tirer plus de durées ne décale pas les arrivées
+ */
+enum class SourceAleatoire : uint32_t {
+    TYPE_OPERATION = 0,
+    DUREE_OPERATION = 1,
+    PRENOM = 2,
+    ARRIVEES_URGENCES = 3,
+    PLAN_EXPERIENCE = 4         // Balayage de paramètres (hypercube latin), hors réplications
+};
+
+/**
+ * Flux pseudo-aléatoire à compteur (Philox4x32-10, Salmon et al. 2011)
+ *
+ * Le bloc n d'un flux est une fonction pure de (graine, identifiant de flux,
+ * source, n): pas d'état partagé, saut arbitraire en O(1), et des flux
+ * indépendants pour chaque réplication et chaque source. Le compteur de
+ * 128 bits est (index 56 bits, source 8 bits, flux 64 bits): deux couples
+ * (flux, source) distincts ne partagent jamais de bloc.
+ * Compatible UniformRandomBitGenerator (valeurs 32 bits).
+ */
+class FluxAleatoire {
+public:
+    using result_type = uint32_t;
+
+private:
+    static constexpr uint32_t MASQUE_INDEX_HAUT = 0x00FFFFFFu;  // Index de bloc sur 56 bits
+
+    uint32_t cle[2];            // Graine (64 bits)
+    uint32_t identifiantFlux[2]; // Réplication (64 bits)
+    uint32_t source;
+    uint32_t compteur;          // Index du bloc courant, 32 bits bas
+    uint32_t compteurHaut;      // 24 bits hauts de l'index (8 bits hauts du mot: source)
+    uint32_t tampon[4];
+    int disponibles;
+
+    static void tour(uint32_t c[4], const uint32_t k[2]) {
+        const uint64_t produit0 = static_cast<uint64_t>(0xD2511F53u) * c[0];
+        const uint64_t produit1 = static_cast<uint64_t>(0xCD9E8D57u) * c[2];
+        const uint32_t hi0 = static_cast<uint32_t>(produit0 >> 32);
+        const uint32_t lo0 = static_cast<uint32_t>(produit0);
+        const uint32_t hi1 = static_cast<uint32_t>(produit1 >> 32);
+        const uint32_t lo1 = static_cast<uint32_t>(produit1);
+        const uint32_t c1 = c[1];
+        const uint32_t c3 = c[3];
+        c[0] = hi1 ^ c1 ^ k[0];
+        c[1] = lo1;
+        c[2] = hi0 ^ c3 ^ k[1];
+        c[3] = lo0;
+    }
+
+    /**
+     * Génère le bloc de 4 mots au compteur courant puis avance le compteur
+     */
+    void genererBloc() {
+        uint32_t c[4] = {compteur, compteurHaut | (source << 24), identifiantFlux[0], identifiantFlux[1]};
+        uint32_t k[2] = {cle[0], cle[1]};
+
+        for (int i = 0; i < 10; i++) {
+            if (i > 0) {
+                k[0] += 0x9E3779B9u;
+                k[1] += 0xBB67AE85u;
+            }
+            tour(c, k);
+        }
+
+        tampon[0] = c[0];
+        tampon[1] = c[1];
+        tampon[2] = c[2];
+        tampon[3] = c[3];
+        disponibles = 4;
+
+        if (++compteur == 0) compteurHaut = (compteurHaut + 1) & MASQUE_INDEX_HAUT;
+    }
+
+public:
+    /**
+     * Constructeur
+     */
+    FluxAleatoire(uint64_t graine = 0, uint64_t flux = 0, SourceAleatoire src = SourceAleatoire::TYPE_OPERATION) {
+        initialiser(graine, flux, src);
+    }
+
+    /**
+     * Positionne le flux au début de (graine, flux, source)
+     */
+    void initialiser(uint64_t graine, uint64_t flux, SourceAleatoire src) {
+        cle[0] = static_cast<uint32_t>(graine);
+        cle[1] = static_cast<uint32_t>(graine >> 32);
+        identifiantFlux[0] = static_cast<uint32_t>(flux);
+        identifiantFlux[1] = static_cast<uint32_t>(flux >> 32);
+        source = static_cast<uint32_t>(src);
+        positionner(0);
+    }
+
+    /**
+     * Saute directement au bloc donné (4 tirages 32 bits par bloc, index sur 56 bits)
+     */
+    void positionner(uint64_t bloc) {
+        compteur = static_cast<uint32_t>(bloc);
+        compteurHaut = static_cast<uint32_t>(bloc >> 32) & MASQUE_INDEX_HAUT;
+        disponibles = 0;
+    }
+
+    /**
+     * Avance de nombreBlocs blocs sans les générer
+     */
+    void sauter(uint64_t nombreBlocs) {
+        positionner(getPosition() + nombreBlocs);
+    }
+
+    /**
+     * Index du prochain bloc à générer
+     */
+    uint64_t getPosition() const {
+        return (static_cast<uint64_t>(compteurHaut) << 32) | compteur;
+    }
+
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return std::numeric_limits<uint32_t>::max(); }
+
+    /**
+     * Tirage 32 bits
+     */
+    result_type operator()() {
+        if (disponibles == 0) {
+            genererBloc();
+        }
+        return tampon[4 - disponibles--];
+    }
+
+    /**
+     * Réel uniforme dans [0, 1) sur 53 bits (identique sur toutes les plateformes)
+     */
+    double uniforme01() {
+        uint64_t haut = (*this)() >> 5;     // 27 bits
+        uint64_t bas = (*this)() >> 6;      // 26 bits
+        return static_cast<double>((haut << 26) | bas) * (1.0 / 9007199254740992.0);
+    }
+
+    /**
+     * Loi exponentielle de paramètre lambda (inversion de la fonction de répartition)
+     */
+    double exponentielle(double lambda) {
+        return -std::log1p(-uniforme01()) / lambda;
+    }
+};
+
+} // namespace AutoMed
+
+#endif // FLUX_ALEATOIRE_HPP
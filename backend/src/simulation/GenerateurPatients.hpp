@@ -1,52 +1,80 @@
 #ifndef GENERATEUR_PATIENTS_HPP
 #define GENERATEUR_PATIENTS_HPP
 
-#include <random>
+#include <algorithm>
+#include <cstdint>
 #include <vector>
 #include <ctime>
 #include "../models/Patient.hpp"
 #include "../enums/PrioritePatient.hpp"
 #include "../enums/TypeOperation.hpp"
+#include "ArenaSimulation.hpp"
+#include "FluxAleatoire.hpp"
 
 namespace AutoMed {
 
 /**
  * Générateur de patients selon distributions statistiques
+ * Les patients sont construits dans l'arène de la simulation (libérés avec elle)
  */
 class GenerateurPatients {
+public:
+    static const int DELAI_MAX_MINUTES = 10 * 365 * 24 * 60;  // Plafond d'un délai d'arrivée (10 ans)
+
 private:
+    ArenaSimulation* arena;
     int prochainId;
     double tauxArriveeHoraireUrgences;    // λ pour loi de Poisson (urgences/heure)
     int nombrePatientsElectifs;            // Nombre d'opérations programmées
+    uint64_t graine;                       // Graine: même graine = mêmes patients
+    uint64_t identifiantFlux;              // Réplication: flux indépendant pour une même graine
     
-    // Générateurs aléatoires
-    std::mt19937 randomEngine;
-    std::uniform_real_distribution<> uniform01;
-    std::exponential_distribution<> expDist;
+    // Un flux à compteur par source stochastique
+    FluxAleatoire fluxTypes;
+    FluxAleatoire fluxDurees;
+    FluxAleatoire fluxPrenoms;
+    FluxAleatoire fluxArrivees;
 
 public:
     /**
      * Constructeur
      */
-    GenerateurPatients(double tauxUrgences = 2.0, int nbElectifs = 10)
-        : prochainId(1),
+    GenerateurPatients(ArenaSimulation& arena, double tauxUrgences = 2.0, int nbElectifs = 10,
+                       uint64_t graine = 1, uint64_t identifiantFlux = 0)
+        : arena(&arena),
+          prochainId(1),
           tauxArriveeHoraireUrgences(tauxUrgences),
           nombrePatientsElectifs(nbElectifs),
-          randomEngine(std::random_device{}()),
-          uniform01(0.0, 1.0),
-          expDist(tauxUrgences) {}
+          graine(graine),
+          identifiantFlux(identifiantFlux) {
+        initialiserGraine(graine, identifiantFlux);
+    }
+
+    /**
+     * Repositionne tous les flux au début de (graine, identifiantFlux):
+     * la suite de patients recommence à l'identique
+     */
+    void initialiserGraine(uint64_t nouvelleGraine, uint64_t nouveauFlux = 0) {
+        graine = nouvelleGraine;
+        identifiantFlux = nouveauFlux;
+        fluxTypes.initialiser(graine, identifiantFlux, SourceAleatoire::TYPE_OPERATION);
+        fluxDurees.initialiser(graine, identifiantFlux, SourceAleatoire::DUREE_OPERATION);
+        fluxPrenoms.initialiser(graine, identifiantFlux, SourceAleatoire::PRENOM);
+        fluxArrivees.initialiser(graine, identifiantFlux, SourceAleatoire::ARRIVEES_URGENCES);
+    }
 
     /**
-     * Génère un patient avec priorité et type d'opération aléatoires
+     * Génère un patient avec priorité et type d'opération aléatoires,
+     * arrivant à l'horodatage virtuel donné
      */
-    Patient* genererPatient(PrioritePatient priorite) {
+    Patient* genererPatient(PrioritePatient priorite, time_t horodatageArrivee) {
         TypeOperation type = genererTypeOperation();
         int duree = genererDureeOperation(type);
         
-        std::string nom = "Patient_" + std::to_string(prochainId);
-        std::string prenom = genererPrenom();
+        // Nom par défaut (Patient_<id>), prénom pris dans la liste constante
+        const std::string* prenom = genererPrenom();
         
-        Patient* patient = new Patient(prochainId++, nom, prenom, priorite, type, duree);
+        Patient* patient = arena->creer<Patient>(prochainId++, prenom, priorite, type, duree, horodatageArrivee);
         
         return patient;
     }
@@ -54,22 +82,22 @@ public:
     /**
      * Génère un patient urgence
      */
-    Patient* genererPatientUrgence() {
-        return genererPatient(PrioritePatient::URGENCE);
+    Patient* genererPatientUrgence(time_t horodatageArrivee) {
+        return genererPatient(PrioritePatient::URGENCE, horodatageArrivee);
     }
 
     /**
      * Génère un patient électif (programmé)
      */
-    Patient* genererPatientElectif() {
-        return genererPatient(PrioritePatient::ELECTIVE);
+    Patient* genererPatientElectif(time_t horodatageArrivee) {
+        return genererPatient(PrioritePatient::ELECTIVE, horodatageArrivee);
     }
 
     /**
      * Génère un patient ambulatoire
      */
-    Patient* genererPatientAmbulatoire() {
-        return genererPatient(PrioritePatient::AMBULATOIRE);
+    Patient* genererPatientAmbulatoire(time_t horodatageArrivee) {
+        return genererPatient(PrioritePatient::AMBULATOIRE, horodatageArrivee);
     }
 
     /**
@@ -77,13 +105,18 @@ public:
      * Utilisé pour les urgences (processus de Poisson)
      */
     int calculerProchainDelaiArriveeMinutes() {
+        // Sans urgences: aucune arrivée dans l'horizon simulé
+        if (tauxArriveeHoraireUrgences <= 0.0) {
+            return DELAI_MAX_MINUTES;
+        }
+        
         // Distribution exponentielle: délai entre 2 arrivées
         // λ = taux par heure → délai moyen = 60/λ minutes
-        double delaiHeures = expDist(randomEngine);
-        int delaiMinutes = static_cast<int>(delaiHeures * 60.0);
+        double delaiHeures = fluxArrivees.exponentielle(tauxArriveeHoraireUrgences);
+        double delaiMinutes = std::min(delaiHeures * 60.0, static_cast<double>(DELAI_MAX_MINUTES));
         
         // Minimum 1 minute pour éviter les événements simultanés
-        return std::max(1, delaiMinutes);
+        return std::max(1, static_cast<int>(delaiMinutes));
     }
 
     /**
@@ -101,13 +134,9 @@ public:
         int intervalle = dureeJourneeMinutes / nombrePatientsElectifs;
         
         for (int i = 0; i < nombrePatientsElectifs; i++) {
-            Patient* patient = genererPatientElectif();
-            
-            // Ajuster l'horodatage d'arrivée avec le temps virtuel
+            // Horodatage d'arrivée en temps virtuel
             time_t heureArrivee = dateDebut + (i * intervalle * 60);
-            patient->setHorodatageArrivee(heureArrivee);
-            
-            patients.push_back(patient);
+            patients.push_back(genererPatientElectif(heureArrivee));
         }
         
         return patients;
@@ -117,7 +146,7 @@ public:
      * Génère un type d'opération aléatoire
      */
     TypeOperation genererTypeOperation() {
-        int rand = static_cast<int>(uniform01(randomEngine) * 10);
+        int rand = static_cast<int>(fluxTypes.uniforme01() * 10);
         
         switch (rand) {
             case 0: return TypeOperation::CARDIAQUE;
@@ -188,7 +217,7 @@ public:
         }
         
         // Ajouter une variabilité aléatoire
-        int variation = static_cast<int>((uniform01(randomEngine) - 0.5) * 2 * variabilite);
+        int variation = static_cast<int>((fluxDurees.uniforme01() - 0.5) * 2 * variabilite);
         int duree = dureeBase + variation;
         
         // Minimum 15 minutes
@@ -196,29 +225,28 @@ public:
     }
 
     /**
-     * Génère un prénom aléatoire
+     * Génère un prénom aléatoire (chaîne de la liste, valable tout le processus)
      */
-    std::string genererPrenom() {
+    const std::string* genererPrenom() {
         static const std::vector<std::string> prenoms = {
             "Jean", "Marie", "Pierre", "Sophie", "Luc", "Anne",
             "Marc", "Julie", "Paul", "Claire", "Jacques", "Nathalie",
             "François", "Isabelle", "Michel", "Catherine", "Philippe", "Sylvie"
         };
         
-        int index = static_cast<int>(uniform01(randomEngine) * prenoms.size());
-        return prenoms[index % prenoms.size()];
+        int index = static_cast<int>(fluxPrenoms.uniforme01() * prenoms.size());
+        return &prenoms[index % prenoms.size()];
     }
 
     // Getters
     double getTauxArriveeHoraireUrgences() const { return tauxArriveeHoraireUrgences; }
     int getNombrePatientsElectifs() const { return nombrePatientsElectifs; }
     int getProchainId() const { return prochainId; }
+    uint64_t getGraine() const { return graine; }
+    uint64_t getIdentifiantFlux() const { return identifiantFlux; }
 
     // Setters
-    void setTauxArriveeHoraireUrgences(double taux) { 
-        tauxArriveeHoraireUrgences = taux;
-        expDist = std::exponential_distribution<>(taux);
-    }
+    void setTauxArriveeHoraireUrgences(double taux) { tauxArriveeHoraireUrgences = taux; }
     void setNombrePatientsElectifs(int nombre) { nombrePatientsElectifs = nombre; }
 };
 
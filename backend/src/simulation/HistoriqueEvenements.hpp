@@ -0,0 +1,98 @@
+#ifndef HISTORIQUE_EVENEMENTS_HPP
+#define HISTORIQUE_EVENEMENTS_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+#include "CalendrierEvenements.hpp"
+#include "../enums/EtatBlocOperatoire.hpp"
+
+namespace AutoMed {
+
+/**
+ * Entrée d'historique: l'événement traité et l'état mutable observé à cet
+ * instant. POD, sans allocation: noms, priorité et type d'opération ne
+ * changent pas et sont relus à la construction de la vue JSON.
+ */
+struct EvenementHistorique {
+    EvenementPlanifie evenement;
+    uint64_t numero;                // Rang de traitement (1, 2, 3...): curseur des clients
+    int tempsEcouleMinutes;         // Temps de simulation au traitement
+    int dureeReelleMinutes;         // Durée réelle du patient à cet instant
+    EtatBlocOperatoire etatBloc;    // État du bloc concerné à cet instant
+    bool equipeDisponible;          // Disponibilité de l'équipe concernée à cet instant
+};
+
+/**
+ * Historique des derniers événements traités (tampon circulaire)
+ *
+ * Capacité fixe allouée une fois: un ajout écrase la plus ancienne entrée
+ * en O(1). Les entrées sont numérotées dans l'ordre de traitement, ce qui
+ * permet aux clients de ne demander que ce qui est arrivé depuis leur
+ * dernier numéro.
+ */
+class HistoriqueEvenements {
+private:
+    std::vector<EvenementHistorique> tampon;
+    uint64_t nombreTotal;       // Entrées ajoutées depuis le début (= dernier numéro)
+
+public:
+    /**
+     * Constructeur
+     */
+    explicit HistoriqueEvenements(size_t capacite = 50)
+        : tampon(capacite > 0 ? capacite : 1),
+          nombreTotal(0) {}
+
+    /**
+     * Ajoute une entrée et lui attribue le numéro suivant
+     */
+    void ajouter(EvenementHistorique entree) {
+        entree.numero = ++nombreTotal;
+        tampon[(entree.numero - 1) % tampon.size()] = entree;
+    }
+
+    /**
+     * Numéro de la plus ancienne entrée encore disponible (0 si vide)
+     */
+    uint64_t getPremierNumero() const {
+        if (nombreTotal == 0) return 0;
+        return nombreTotal > tampon.size() ? nombreTotal - tampon.size() + 1 : 1;
+    }
+
+    uint64_t getDernierNumero() const { return nombreTotal; }
+
+    /**
+     * Parcourt dans l'ordre les entrées de numéro > depuis encore disponibles
+     */
+    template <typename Fonction>
+    void parcourirDepuis(uint64_t depuis, Fonction fonction) const {
+        if (nombreTotal == 0) return;
+        uint64_t debut = std::max(depuis + 1, getPremierNumero());
+        for (uint64_t numero = debut; numero <= nombreTotal; numero++) {
+            fonction(tampon[(numero - 1) % tampon.size()]);
+        }
+    }
+
+    /**
+     * Vrai si des entrées postérieures à depuis ont déjà été écrasées
+     */
+    bool estTronqueDepuis(uint64_t depuis) const {
+        return nombreTotal > 0 && depuis + 1 < getPremierNumero();
+    }
+
+    /**
+     * Vide l'historique (capacité éventuellement modifiée)
+     */
+    void vider(size_t capacite) {
+        tampon.assign(capacite > 0 ? capacite : 1, EvenementHistorique());
+        nombreTotal = 0;
+    }
+
+    size_t getCapacite() const { return tampon.size(); }
+    size_t getTaille() const { return nombreTotal < tampon.size() ? static_cast<size_t>(nombreTotal) : tampon.size(); }
+};
+
+} // namespace AutoMed
+
+#endif // HISTORIQUE_EVENEMENTS_HPP
@@ -0,0 +1,52 @@
+#ifndef HORLOGE_VIRTUELLE_HPP
+#define HORLOGE_VIRTUELLE_HPP
+
+#include <cstdint>
+#include <ctime>
+
+namespace AutoMed {
+
+/**
+ * Horloge virtuelle d'une simulation (secondes)
+ *
+ * Seule source du temps de la simulation: le moteur la fait avancer à
+ * chaque événement, les modèles reçoivent l'heure courante en paramètre et
+ * les statistiques lisent l'horloge du moteur. L'origine est un horodatage
+ * réel lu une fois à la création (dates lisibles dans l'API); ensuite aucun
+ * appel système, et les durées sont justes quel que soit facteurVitesse.
+ */
+class HorlogeVirtuelle {
+private:
+    time_t origine;         // Minute 0 de la simulation
+    time_t maintenant;
+
+public:
+    HorlogeVirtuelle() : origine(0), maintenant(0) {}
+
+    /**
+     * Remet l'horloge à l'origine donnée
+     */
+    void demarrer(time_t nouvelleOrigine) {
+        origine = nouvelleOrigine;
+        maintenant = nouvelleOrigine;
+    }
+
+    /**
+     * Avance jusqu'à horodatage (les événements arrivent dans l'ordre)
+     */
+    void avancer(time_t horodatage) { maintenant = horodatage; }
+
+    time_t getOrigine() const { return origine; }
+    time_t getMaintenant() const { return maintenant; }
+    int64_t getSecondesEcoulees() const { return static_cast<int64_t>(maintenant - origine); }
+    int getMinutesEcoulees() const { return static_cast<int>(getSecondesEcoulees() / 60); }
+
+    /**
+     * Horodatage minutes après maintenant
+     */
+    time_t dansMinutes(int64_t minutes) const { return maintenant + static_cast<time_t>(minutes * 60); }
+};
+
+} // namespace AutoMed
+
+#endif // HORLOGE_VIRTUELLE_HPP
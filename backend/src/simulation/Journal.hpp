@@ -0,0 +1,268 @@
+#ifndef JOURNAL_HPP
+#define JOURNAL_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <ostream>
+#include <streambuf>
+#include <thread>
+#include "../enums/NiveauJournal.hpp"
+
+/**
+ * Niveau minimal compilé: les appels en dessous disparaissent du binaire
+ * (ex: -DAUTOMED_JOURNAL_NIVEAU_MIN=2 pour ne garder que INFO et au-delà)
+ */
+#ifndef AUTOMED_JOURNAL_NIVEAU_MIN
+#define AUTOMED_JOURNAL_NIVEAU_MIN 0
+#endif
+
+namespace AutoMed {
+
+/**
+ * Message formaté, copié tel quel dans la file
+ */
+struct EnregistrementJournal {
+    static const size_t TAILLE_TEXTE = 500;
+
+    NiveauJournal niveau;
+    int source;                 // Id de la simulation (-1 si aucune)
+    uint32_t longueur;
+    char texte[TAILLE_TEXTE];
+};
+
+/**
+ * Journal asynchrone (un par processus)
+ *
+ * Les producteurs déposent leurs messages dans une file circulaire bornée
+ * sans verrou (Vyukov, multi-producteurs); un thread d'écriture la vide vers
+ * la console. Un dépôt ne fait ni allocation ni appel système: si la file
+ * est pleine, le message est perdu et compté plutôt que de bloquer la simulation.
+ */
+class JournalAsynchrone {
+public:
+    static const size_t CAPACITE = 4096;    // Puissance de 2
+
+private:
+    struct Cellule {
+        std::atomic<size_t> sequence;
+        EnregistrementJournal donnees;
+    };
+
+    std::unique_ptr<Cellule[]> cellules;
+    alignas(64) std::atomic<size_t> positionEcriture;
+    alignas(64) std::atomic<size_t> positionLecture;
+    std::atomic<uint64_t> messagesPerdus;
+    std::atomic<bool> arret;
+    std::ostream& sortie;
+    std::thread ecrivain;
+
+    static inline std::atomic<bool> demarre{false};
+
+    bool retirer(EnregistrementJournal& enregistrement) {
+        size_t position = positionLecture.load(std::memory_order_relaxed);
+        Cellule& cellule = cellules[position & (CAPACITE - 1)];
+        if (cellule.sequence.load(std::memory_order_acquire) != position + 1) {
+            return false;
+        }
+        enregistrement = cellule.donnees;
+        cellule.sequence.store(position + CAPACITE, std::memory_order_release);
+        positionLecture.store(position + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * Écrit tout ce qui est disponible; retourne le nombre de messages écrits
+     */
+    size_t vidange() {
+        EnregistrementJournal enregistrement;
+        size_t nombre = 0;
+        while (retirer(enregistrement)) {
+            sortie.write(enregistrement.texte, enregistrement.longueur);
+            sortie.put('\n');
+            nombre++;
+        }
+        if (nombre > 0) sortie.flush();
+        return nombre;
+    }
+
+    void boucle() {
+        while (!arret.load(std::memory_order_acquire)) {
+            if (vidange() == 0) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(2));
+            }
+        }
+        vidange();
+
+        uint64_t perdus = messagesPerdus.load();
+        if (perdus > 0) {
+            sortie << "[JOURNAL] " << perdus << " message(s) perdu(s): file pleine" << std::endl;
+        }
+    }
+
+    explicit JournalAsynchrone(std::ostream& sortie = std::cout)
+        : cellules(new Cellule[CAPACITE]),
+          positionEcriture(0),
+          positionLecture(0),
+          messagesPerdus(0),
+          arret(false),
+          sortie(sortie) {
+        for (size_t i = 0; i < CAPACITE; i++) {
+            cellules[i].sequence.store(i, std::memory_order_relaxed);
+        }
+        ecrivain = std::thread([this] { boucle(); });
+        demarre.store(true, std::memory_order_release);
+    }
+
+public:
+    /**
+     * Instance du processus (thread d'écriture démarré au premier message)
+     */
+    static JournalAsynchrone& instance() {
+        static JournalAsynchrone journal;
+        return journal;
+    }
+
+    ~JournalAsynchrone() {
+        arret.store(true, std::memory_order_release);
+        if (ecrivain.joinable()) ecrivain.join();
+    }
+
+    JournalAsynchrone(const JournalAsynchrone&) = delete;
+    JournalAsynchrone& operator=(const JournalAsynchrone&) = delete;
+
+    /**
+     * Dépose un message (sans attente); false si la file est pleine
+     */
+    bool deposer(const EnregistrementJournal& enregistrement) {
+        size_t position = positionEcriture.load(std::memory_order_relaxed);
+        Cellule* cellule;
+        while (true) {
+            cellule = &cellules[position & (CAPACITE - 1)];
+            size_t sequence = cellule->sequence.load(std::memory_order_acquire);
+            intptr_t difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+            if (difference == 0) {
+                if (positionEcriture.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (difference < 0) {
+                messagesPerdus.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            } else {
+                position = positionEcriture.load(std::memory_order_relaxed);
+            }
+        }
+
+        // Ne copie que l'en-tête et le texte utile
+        cellule->donnees.niveau = enregistrement.niveau;
+        cellule->donnees.source = enregistrement.source;
+        cellule->donnees.longueur = enregistrement.longueur;
+        std::memcpy(cellule->donnees.texte, enregistrement.texte, enregistrement.longueur);
+        cellule->sequence.store(position + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * Attend que tous les messages déposés jusqu'ici soient écrits
+     * (avant un affichage direct sur la console, pour ne pas les entrelacer)
+     */
+    void vider() {
+        size_t cible = positionEcriture.load(std::memory_order_acquire);
+        while (positionLecture.load(std::memory_order_acquire) < cible) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+
+    uint64_t getMessagesPerdus() const { return messagesPerdus.load(); }
+
+    static bool estDemarre() { return demarre.load(std::memory_order_acquire); }
+};
+
+/**
+ * Journal d'un composant: niveau courant et source des messages
+ * Tester estActif() ne coûte qu'une comparaison
+ */
+class Journal {
+private:
+    NiveauJournal niveau;
+    int source;
+
+public:
+    explicit Journal(NiveauJournal niveau = NiveauJournal::INFO, int source = -1)
+        : niveau(niveau), source(source) {}
+
+    bool estActif(NiveauJournal niveauMessage) const {
+        return static_cast<int>(niveauMessage) >= AUTOMED_JOURNAL_NIVEAU_MIN
+            && niveauMessage >= niveau
+            && niveauMessage != NiveauJournal::AUCUN;
+    }
+
+    void setNiveau(NiveauJournal nouveauNiveau) { niveau = nouveauNiveau; }
+    NiveauJournal getNiveau() const { return niveau; }
+    void setSource(int nouvelleSource) { source = nouvelleSource; }
+    int getSource() const { return source; }
+
+    /**
+     * Attend l'écriture des messages en attente (no-op si rien n'a jamais été journalisé)
+     */
+    static void vider() {
+        if (JournalAsynchrone::estDemarre()) {
+            JournalAsynchrone::instance().vider();
+        }
+    }
+};
+
+/**
+ * Une ligne en cours de formatage: flux sur le tampon de l'enregistrement,
+ * déposé dans la file à la destruction. Pas d'allocation (texte tronqué au-delà
+ * de TAILLE_TEXTE).
+ */
+class LigneJournal : private std::streambuf {
+private:
+    EnregistrementJournal enregistrement;
+    std::ostream flux;
+
+public:
+    LigneJournal(const Journal& journal, NiveauJournal niveau)
+        : flux(this) {
+        enregistrement.niveau = niveau;
+        enregistrement.source = journal.getSource();
+        setp(enregistrement.texte, enregistrement.texte + EnregistrementJournal::TAILLE_TEXTE);
+    }
+
+    ~LigneJournal() {
+        enregistrement.longueur = static_cast<uint32_t>(pptr() - pbase());
+        JournalAsynchrone::instance().deposer(enregistrement);
+    }
+
+    LigneJournal(const LigneJournal&) = delete;
+    LigneJournal& operator=(const LigneJournal&) = delete;
+
+    std::ostream& getFlux() { return flux; }
+};
+
+} // namespace AutoMed
+
+/**
+ * Journalise si le niveau est compilé et actif; sinon le message n'est
+ * même pas évalué. Usage: JOURNAL_TRACE(journal, "x = " << x);
+ */
+#define AUTOMED_JOURNAL(journal, niveauMessage, message)                          \
+    do {                                                                          \
+        if (static_cast<int>(niveauMessage) >= AUTOMED_JOURNAL_NIVEAU_MIN         \
+            && (journal).estActif(niveauMessage)) {                               \
+            ::AutoMed::LigneJournal ligneJournal_((journal), (niveauMessage));    \
+            ligneJournal_.getFlux() << message;                                   \
+        }                                                                         \
+    } while (0)
+
+#define JOURNAL_TRACE(journal, message) AUTOMED_JOURNAL(journal, ::AutoMed::NiveauJournal::TRACE, message)
+#define JOURNAL_DEBUG(journal, message) AUTOMED_JOURNAL(journal, ::AutoMed::NiveauJournal::DEBUG, message)
+#define JOURNAL_INFO(journal, message) AUTOMED_JOURNAL(journal, ::AutoMed::NiveauJournal::INFO, message)
+#define JOURNAL_AVERTISSEMENT(journal, message) AUTOMED_JOURNAL(journal, ::AutoMed::NiveauJournal::AVERTISSEMENT, message)
+#define JOURNAL_ERREUR(journal, message) AUTOMED_JOURNAL(journal, ::AutoMed::NiveauJournal::ERREUR, message)
+
+#endif // JOURNAL_HPP
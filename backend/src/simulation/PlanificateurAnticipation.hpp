@@ -0,0 +1,243 @@
+#ifndef PLANIFICATEUR_ANTICIPATION_HPP
+#define PLANIFICATEUR_ANTICIPATION_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <ctime>
+#include <limits>
+#include <vector>
+#include "../models/Patient.hpp"
+#include "../models/PolitiquesOrdonnancement.hpp"
+
+namespace AutoMed {
+
+/**
+ * Démarrage décidé par le planificateur (indices = position dans les vecteurs du moteur)
+ */
+struct AffectationAnticipee {
+    Patient* patient;
+    size_t indiceBloc;
+    size_t indiceEquipe;
+};
+
+/**
+ * Planificateur par anticipation (horizon glissant)
+ *
+ * À chaque décision, les patients en attente et les arrivées programmées de
+ * l'horizon sont placés sur les blocs et équipes selon un ordre de passage:
+ * chaque patient prend l'équipe compatible libérée le plus tôt et un bloc
+ * libre à ce moment-là. Le coût d'un ordre est l'attente pondérée par la
+ * priorité (poids WSJF); un patient qui ne démarre pas dans l'horizon compte
+ * jusqu'à la fin de l'horizon.
+ *
+ * Ordre initial WSJF, puis recherche locale par échanges de deux patients
+ * (premier échange améliorant) bornée en nombre d'évaluations: le budget de
+ * temps est converti une fois en évaluations (MICROSECONDES_PAR_EVALUATION,
+ * au plus MAX_EVALUATIONS), jamais comparé à l'horloge. Le plan ne dépend donc
+ * ni de la machine ni de sa charge, et les réplications restent
+ * reproductibles; le temps réel est mesuré à part (dépassements du budget).
+ * Seuls les démarrages immédiats sont appliqués; le reste du plan est
+ * recalculé à la décision suivante.
+ */
+class PlanificateurAnticipation {
+public:
+    static constexpr size_t MAX_CANDIDATS_ATTENTE = 24;     // Meilleurs patients en attente (ordre WSJF)
+    static constexpr size_t MAX_CANDIDATS_PROGRAMMES = 8;   // Premières arrivées programmées de l'horizon
+    static constexpr size_t MAX_EVALUATIONS = 256;          // Borne déterministe de la recherche locale
+    static constexpr int MICROSECONDES_PAR_EVALUATION = 2;  // Coût prudent d'une évaluation (~1,3 µs mesuré, 12 blocs)
+    static constexpr time_t JAMAIS = std::numeric_limits<time_t>::max();
+
+private:
+    struct Candidat {
+        Patient* patient;
+        time_t arrivee;
+        time_t dureeSecondes;
+        double poids;
+        uint32_t masqueType;
+        bool enAttente;             // false: arrivée programmée, pas encore dans la salle
+        PolitiqueWSJF::Cle cle;
+    };
+
+    time_t horizonSecondes;
+    size_t limiteEvaluations;               // Budget converti en évaluations
+    time_t nettoyageSecondes;
+    std::vector<uint32_t> typesParEquipe;   // Types d'opération compatibles, par équipe
+
+    // Tampons réutilisés d'une décision à l'autre
+    time_t maintenant;
+    std::vector<time_t> liberationBlocs;
+    std::vector<time_t> liberationEquipes;
+    std::vector<time_t> blocs;
+    std::vector<time_t> equipes;
+    std::vector<Candidat> candidats;
+    std::vector<size_t> ordre;
+    std::vector<AffectationAnticipee> affectations;
+
+    // Bilan de la dernière décision
+    size_t nombreEvaluations;
+    bool budgetAtteint;                     // Recherche arrêtée par limiteEvaluations
+
+    /**
+     * Place les candidats dans l'ordre donné et retourne l'attente pondérée
+     * (minutes); avecAffectations retient les démarrages immédiats
+     */
+    double evaluer(const std::vector<size_t>& ordreCandidats, bool avecAffectations) {
+        blocs = liberationBlocs;
+        equipes = liberationEquipes;
+        time_t finHorizon = maintenant + horizonSecondes;
+        double coutPlan = 0.0;
+
+        for (size_t indice : ordreCandidats) {
+            const Candidat& candidat = candidats[indice];
+
+            size_t equipe = equipes.size();
+            for (size_t e = 0; e < equipes.size(); e++) {
+                if (!(typesParEquipe[e] & candidat.masqueType)) continue;
+                if (equipe == equipes.size() || equipes[e] < equipes[equipe]) equipe = e;
+            }
+
+            // Bloc libéré le plus tard avant l'équipe (à défaut le plus tôt):
+            // un bloc libre n'est pas immobilisé en attendant une équipe
+            time_t debut = JAMAIS;
+            size_t bloc = blocs.size();
+            if (equipe < equipes.size() && equipes[equipe] != JAMAIS) {
+                time_t pret = std::max(candidat.arrivee, equipes[equipe]);
+                size_t plusTot = blocs.size();
+                for (size_t b = 0; b < blocs.size(); b++) {
+                    if (blocs[b] <= pret && (bloc == blocs.size() || blocs[b] > blocs[bloc])) bloc = b;
+                    if (plusTot == blocs.size() || blocs[b] < blocs[plusTot]) plusTot = b;
+                }
+                if (bloc == blocs.size()) bloc = plusTot;
+                if (bloc < blocs.size() && blocs[bloc] != JAMAIS) debut = std::max(pret, blocs[bloc]);
+            }
+            if (debut > finHorizon) {
+                coutPlan += candidat.poids * (finHorizon - candidat.arrivee) / 60.0;
+                continue;
+            }
+
+            coutPlan += candidat.poids * (debut - candidat.arrivee) / 60.0;
+            time_t liberation = debut + candidat.dureeSecondes + nettoyageSecondes;
+            blocs[bloc] = liberation;
+            equipes[equipe] = liberation;
+
+            if (avecAffectations && candidat.enAttente && debut <= maintenant) {
+                affectations.push_back(AffectationAnticipee{candidat.patient, bloc, equipe});
+            }
+        }
+        nombreEvaluations++;
+        return coutPlan;
+    }
+
+    void ajouterCandidat(Patient* patient, bool enAttente, uint64_t sequence) {
+        candidats.push_back(Candidat{
+            patient,
+            patient->getHorodatageArrivee(),
+            static_cast<time_t>(patient->getDureeEstimeeMinutes()) * 60,
+            PolitiqueWSJF::poids(patient->getPriorite()),
+            masqueTypeOperation(patient->getTypeOperation()),
+            enAttente,
+            PolitiqueWSJF::cle(*patient, sequence)
+        });
+    }
+
+public:
+    PlanificateurAnticipation()
+        : horizonSecondes(0), limiteEvaluations(MAX_EVALUATIONS), nettoyageSecondes(0), maintenant(0),
+          nombreEvaluations(0), budgetAtteint(false) {}
+
+    /**
+     * Paramètres de la simulation et compatibilité des équipes
+     */
+    void configurer(int horizonMinutes, int budgetMicrosecondes, int nettoyageMinutes,
+                    const std::vector<uint32_t>& typesCompatibles) {
+        horizonSecondes = static_cast<time_t>(std::max(0, horizonMinutes)) * 60;
+        limiteEvaluations = std::min(MAX_EVALUATIONS,
+            static_cast<size_t>(std::max(1, budgetMicrosecondes / MICROSECONDES_PAR_EVALUATION)));
+        nettoyageSecondes = static_cast<time_t>(nettoyageMinutes) * 60;
+        typesParEquipe = typesCompatibles;
+    }
+
+    /**
+     * Nouvelle décision: instants de libération des blocs et des équipes
+     * (maintenant si libre, JAMAIS si indisponible sans échéance connue)
+     */
+    void commencer(time_t instant, size_t nombreBlocs, size_t nombreEquipes) {
+        maintenant = instant;
+        liberationBlocs.assign(nombreBlocs, JAMAIS);
+        liberationEquipes.assign(nombreEquipes, JAMAIS);
+        candidats.clear();
+        affectations.clear();
+        nombreEvaluations = 0;
+        budgetAtteint = false;
+    }
+
+    void setLiberationBloc(size_t indice, time_t instant) { liberationBlocs[indice] = instant; }
+    void setLiberationEquipe(size_t indice, time_t instant) { liberationEquipes[indice] = instant; }
+    time_t getHorizonSecondes() const { return horizonSecondes; }
+
+    void ajouterPatientEnAttente(Patient* patient, uint64_t sequence) { ajouterCandidat(patient, true, sequence); }
+
+    /**
+     * Arrivée programmée dans l'horizon (rang après tous les patients déjà arrivés)
+     */
+    void ajouterArriveeProgrammee(Patient* patient) {
+        ajouterCandidat(patient, false, std::numeric_limits<uint64_t>::max());
+    }
+
+    /**
+     * Calcule le plan et retourne les démarrages immédiats
+     */
+    const std::vector<AffectationAnticipee>& planifier() {
+        // Garder les meilleurs candidats de chaque catégorie (ordre WSJF)
+        auto parCle = [](const Candidat& a, const Candidat& b) { return a.cle < b.cle; };
+        auto programmes = std::stable_partition(candidats.begin(), candidats.end(),
+            [](const Candidat& c) { return c.enAttente; });
+        size_t nombreAttente = static_cast<size_t>(programmes - candidats.begin());
+        if (nombreAttente > MAX_CANDIDATS_ATTENTE) {
+            std::partial_sort(candidats.begin(), candidats.begin() + MAX_CANDIDATS_ATTENTE, programmes, parCle);
+            candidats.erase(candidats.begin() + MAX_CANDIDATS_ATTENTE, programmes);
+            nombreAttente = MAX_CANDIDATS_ATTENTE;
+        }
+        if (candidats.size() - nombreAttente > MAX_CANDIDATS_PROGRAMMES) {
+            candidats.resize(nombreAttente + MAX_CANDIDATS_PROGRAMMES);
+        }
+        std::sort(candidats.begin(), candidats.end(), parCle);
+
+        ordre.resize(candidats.size());
+        for (size_t i = 0; i < ordre.size(); i++) ordre[i] = i;
+
+        // Recherche locale: premier échange améliorant, recommencée tant qu'elle progresse
+        double meilleurCout = evaluer(ordre, false);
+        bool ameliore = true;
+        while (ameliore && !budgetAtteint) {
+            ameliore = false;
+            for (size_t i = 0; i + 1 < ordre.size() && !ameliore; i++) {
+                for (size_t j = i + 1; j < ordre.size(); j++) {
+                    if (nombreEvaluations >= limiteEvaluations) {
+                        budgetAtteint = true;
+                        break;
+                    }
+                    std::swap(ordre[i], ordre[j]);
+                    double coutEchange = evaluer(ordre, false);
+                    if (coutEchange < meilleurCout - 1e-9) {
+                        meilleurCout = coutEchange;
+                        ameliore = true;
+                        break;
+                    }
+                    std::swap(ordre[i], ordre[j]);
+                }
+                if (budgetAtteint) break;
+            }
+        }
+
+        evaluer(ordre, true);
+        return affectations;
+    }
+
+    size_t getNombreEvaluations() const { return nombreEvaluations; }
+    bool estBudgetAtteint() const { return budgetAtteint; }
+};
+
+} // namespace AutoMed
+
+#endif // PLANIFICATEUR_ANTICIPATION_HPP
@@ -0,0 +1,223 @@
+#ifndef REGISTRE_PATIENTS_HPP
+#define REGISTRE_PATIENTS_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <ctime>
+#include <vector>
+#include "../models/Patient.hpp"
+#include "../enums/PrioritePatient.hpp"
+#include "../enums/TypeOperation.hpp"
+
+namespace AutoMed {
+
+/**
+ * Registre des patients d'une simulation, rangé par colonnes
+ *
+ * Indice = id - 1 (ids attribués à la suite par le générateur). Chaque
+ * donnée utile aux statistiques (priorité, type, durée estimée, horodatages)
+ * a son propre tableau contigu: une passe de calcul ne lit que les colonnes
+ * dont elle a besoin, sans suivre de pointeur ni brancher (boucles
+ * vectorisables). L'objet Patient reste la vue complète (noms, JSON).
+ * Un horodatage à 0 signifie « pas encore atteint ». Chaque colonne est
+ * écrite une fois par étape (arrivée, début et fin d'opération, sortie);
+ * Statistics tient ses accumulateurs en flux, calculerSynthese() en est le
+ * recalcul exact.
+ */
+class RegistrePatients {
+public:
+    // Octets occupés par un patient dans l'ensemble des colonnes
+    static constexpr size_t OCTETS_PAR_PATIENT =
+        sizeof(Patient*) + 2 * sizeof(uint8_t) + sizeof(int32_t) + 4 * sizeof(int64_t);
+
+    /**
+     * Somme, nombre et maximum d'une mesure en minutes
+     */
+    struct Mesure {
+        int64_t somme = 0;
+        int64_t nombre = 0;
+        int64_t max = 0;
+
+        double getMoyenne() const {
+            return nombre > 0 ? static_cast<double>(somme) / nombre : 0.0;
+        }
+    };
+
+    /**
+     * Résultat d'une passe sur les colonnes
+     */
+    struct Synthese {
+        Mesure attente;                         // Arrivée → début d'opération
+        std::array<Mesure, 3> attenteParPriorite;  // Indice = priorité - URGENCE
+        Mesure dureeOperation;                  // Début → fin d'opération
+        Mesure sejour;                          // Arrivée → sortie de réveil
+
+        const Mesure& getAttente(PrioritePatient priorite) const {
+            return attenteParPriorite[static_cast<size_t>(priorite) - static_cast<size_t>(PrioritePatient::URGENCE)];
+        }
+    };
+
+private:
+    std::vector<Patient*> patients;
+    std::vector<uint8_t> priorites;
+    std::vector<uint8_t> types;
+    std::vector<int32_t> dureesEstimeesMinutes;
+    std::vector<int64_t> arrivees;
+    std::vector<int64_t> debutsOperation;
+    std::vector<int64_t> finsOperation;
+    std::vector<int64_t> sorties;
+
+    size_t indice(int id) const { return static_cast<size_t>(id - 1); }
+
+    void redimensionner(size_t taille) {
+        patients.resize(taille, nullptr);
+        priorites.resize(taille, 0);
+        types.resize(taille, 0);
+        dureesEstimeesMinutes.resize(taille, 0);
+        arrivees.resize(taille, 0);
+        debutsOperation.resize(taille, 0);
+        finsOperation.resize(taille, 0);
+        sorties.resize(taille, 0);
+    }
+
+public:
+    /**
+     * Prépare la place de nombrePatients patients dans chaque colonne
+     */
+    void reserver(size_t nombrePatients) {
+        patients.reserve(nombrePatients);
+        priorites.reserve(nombrePatients);
+        types.reserve(nombrePatients);
+        dureesEstimeesMinutes.reserve(nombrePatients);
+        arrivees.reserve(nombrePatients);
+        debutsOperation.reserve(nombrePatients);
+        finsOperation.reserve(nombrePatients);
+        sorties.reserve(nombrePatients);
+    }
+
+    /**
+     * Vide le registre (la capacité des colonnes est gardée)
+     */
+    void vider() {
+        redimensionner(0);
+    }
+
+    /**
+     * Référence un patient créé par le générateur, arrivée comprise
+     */
+    void ajouter(Patient* patient) {
+        if (!patient || patient->getId() <= 0) return;
+
+        size_t i = indice(patient->getId());
+        if (i >= patients.size()) redimensionner(i + 1);
+
+        patients[i] = patient;
+        priorites[i] = static_cast<uint8_t>(patient->getPriorite());
+        types[i] = static_cast<uint8_t>(patient->getTypeOperation());
+        dureesEstimeesMinutes[i] = patient->getDureeEstimeeMinutes();
+        arrivees[i] = patient->getHorodatageArrivee();
+        debutsOperation[i] = patient->getHorodatageDebutOperation();
+        finsOperation[i] = patient->getHorodatageFinOperation();
+        sorties[i] = 0;
+    }
+
+    /**
+     * Trouve un patient par id (nullptr si inconnu)
+     */
+    Patient* trouver(int id) const {
+        size_t i = indice(id);
+        return id > 0 && i < patients.size() ? patients[i] : nullptr;
+    }
+
+    bool contient(int id) const { return trouver(id) != nullptr; }
+
+    void enregistrerDebutOperation(int id, time_t horodatage) {
+        if (contient(id)) debutsOperation[indice(id)] = horodatage;
+    }
+
+    void enregistrerFinOperation(int id, time_t horodatage) {
+        if (contient(id)) finsOperation[indice(id)] = horodatage;
+    }
+
+    void enregistrerSortie(int id, time_t horodatage) {
+        if (contient(id)) sorties[indice(id)] = horodatage;
+    }
+
+    /**
+     * Passe unique sur les colonnes d'horodatages: attentes (globale et par
+     * priorité), durées d'opération et séjours, en minutes entières comme
+     * Patient::getTempsAttenteMinutes(). Les patients qui n'ont pas atteint
+     * l'étape sont masqués par multiplication plutôt que par un test
+     */
+    Synthese calculerSynthese() const {
+        Synthese synthese;
+        const size_t n = patients.size();
+        const uint8_t* priorite = priorites.data();
+        const int64_t* arrivee = arrivees.data();
+        const int64_t* debut = debutsOperation.data();
+        const int64_t* fin = finsOperation.data();
+        const int64_t* sortie = sorties.data();
+
+        const uint8_t urgence = static_cast<uint8_t>(PrioritePatient::URGENCE);
+        const uint8_t elective = static_cast<uint8_t>(PrioritePatient::ELECTIVE);
+        const uint8_t ambulatoire = static_cast<uint8_t>(PrioritePatient::AMBULATOIRE);
+
+        int64_t sommeAttente[3] = {0, 0, 0};
+        int64_t nombreAttente[3] = {0, 0, 0};
+        int64_t maxAttente = 0;
+        int64_t sommeDuree = 0, nombreDuree = 0;
+        int64_t sommeSejour = 0, nombreSejour = 0;
+
+        for (size_t i = 0; i < n; i++) {
+            int64_t opere = debut[i] != 0;
+            int64_t termine = opere & (fin[i] != 0);
+            int64_t sorti = sortie[i] != 0;
+
+            int64_t attente = opere * ((debut[i] - arrivee[i]) / 60);
+            int64_t estUrgence = opere & (priorite[i] == urgence);
+            int64_t estElective = opere & (priorite[i] == elective);
+            int64_t estAmbulatoire = opere & (priorite[i] == ambulatoire);
+
+            sommeAttente[0] += estUrgence * attente;
+            sommeAttente[1] += estElective * attente;
+            sommeAttente[2] += estAmbulatoire * attente;
+            nombreAttente[0] += estUrgence;
+            nombreAttente[1] += estElective;
+            nombreAttente[2] += estAmbulatoire;
+            maxAttente = std::max(maxAttente, attente);
+
+            sommeDuree += termine * ((fin[i] - debut[i]) / 60);
+            nombreDuree += termine;
+            sommeSejour += sorti * ((sortie[i] - arrivee[i]) / 60);
+            nombreSejour += sorti;
+        }
+
+        for (size_t p = 0; p < 3; p++) {
+            synthese.attenteParPriorite[p].somme = sommeAttente[p];
+            synthese.attenteParPriorite[p].nombre = nombreAttente[p];
+            synthese.attente.somme += sommeAttente[p];
+            synthese.attente.nombre += nombreAttente[p];
+        }
+        synthese.attente.max = maxAttente;
+        synthese.dureeOperation.somme = sommeDuree;
+        synthese.dureeOperation.nombre = nombreDuree;
+        synthese.sejour.somme = sommeSejour;
+        synthese.sejour.nombre = nombreSejour;
+        return synthese;
+    }
+
+    // Colonnes (lecture seule), indice = id - 1
+    size_t getNombrePatients() const { return patients.size(); }
+    const std::vector<uint8_t>& getPriorites() const { return priorites; }
+    const std::vector<uint8_t>& getTypes() const { return types; }
+    const std::vector<int32_t>& getDureesEstimeesMinutes() const { return dureesEstimeesMinutes; }
+    const std::vector<int64_t>& getArrivees() const { return arrivees; }
+    const std::vector<int64_t>& getDebutsOperation() const { return debutsOperation; }
+    const std::vector<int64_t>& getFinsOperation() const { return finsOperation; }
+    const std::vector<int64_t>& getSorties() const { return sorties; }
+};
+
+} // namespace AutoMed
+
+#endif // REGISTRE_PATIENTS_HPP
@@ -0,0 +1,281 @@
+#ifndef RESSOURCES_LIBRES_HPP
+#define RESSOURCES_LIBRES_HPP
+
+#include <array>
+#include <cstdint>
+#include <vector>
+#include "../models/BlocOperatoire.hpp"
+#include "../models/EquipeMedicale.hpp"
+
+namespace AutoMed {
+
+/**
+ * Ensemble d'indices sous forme de masque de bits à deux niveaux
+ *
+ * Un mot de résumé marque les mots non vides: ajout, retrait, test et
+ * recherche du plus petit indice en temps constant jusqu'à 4096 indices
+ * par mot de résumé (quelques mots au-delà).
+ */
+class EnsembleIndices {
+private:
+    std::vector<uint64_t> mots;
+    std::vector<uint64_t> resume;   // Bit i = mots[i] non vide
+    size_t taille;
+    size_t nombre;
+
+public:
+    static constexpr size_t AUCUN = static_cast<size_t>(-1);
+
+    explicit EnsembleIndices(size_t taille = 0) {
+        redimensionner(taille);
+    }
+
+    /**
+     * Vide l'ensemble et fixe le nombre d'indices possibles
+     */
+    void redimensionner(size_t nouvelleTaille) {
+        taille = nouvelleTaille;
+        nombre = 0;
+        mots.assign((taille + 63) / 64, 0);
+        resume.assign((mots.size() + 63) / 64, 0);
+    }
+
+    bool contient(size_t indice) const {
+        return indice < taille && (mots[indice / 64] >> (indice % 64)) & 1;
+    }
+
+    void ajouter(size_t indice) {
+        if (indice >= taille || contient(indice)) return;
+        size_t mot = indice / 64;
+        mots[mot] |= uint64_t(1) << (indice % 64);
+        resume[mot / 64] |= uint64_t(1) << (mot % 64);
+        nombre++;
+    }
+
+    void retirer(size_t indice) {
+        if (!contient(indice)) return;
+        size_t mot = indice / 64;
+        mots[mot] &= ~(uint64_t(1) << (indice % 64));
+        if (mots[mot] == 0) {
+            resume[mot / 64] &= ~(uint64_t(1) << (mot % 64));
+        }
+        nombre--;
+    }
+
+    /**
+     * Plus petit indice présent (AUCUN si vide)
+     */
+    size_t getPremier() const {
+        for (size_t r = 0; r < resume.size(); r++) {
+            if (resume[r] == 0) continue;
+            size_t mot = r * 64 + static_cast<size_t>(__builtin_ctzll(resume[r]));
+            return mot * 64 + static_cast<size_t>(__builtin_ctzll(mots[mot]));
+        }
+        return AUCUN;
+    }
+
+    /**
+     * Plus petit indice présent strictement supérieur à indice (AUCUN s'il n'y en a pas)
+     */
+    size_t getSuivant(size_t indice) const {
+        size_t debut = indice + 1;
+        if (debut >= taille) return AUCUN;
+
+        size_t mot = debut / 64;
+        uint64_t bits = mots[mot] & (~uint64_t(0) << (debut % 64));
+        if (bits) return mot * 64 + static_cast<size_t>(__builtin_ctzll(bits));
+
+        size_t motSuivant = mot + 1;
+        for (size_t r = motSuivant / 64; r < resume.size(); r++) {
+            uint64_t occupes = resume[r];
+            if (r == motSuivant / 64) occupes &= ~uint64_t(0) << (motSuivant % 64);
+            if (occupes == 0) continue;
+            size_t m = r * 64 + static_cast<size_t>(__builtin_ctzll(occupes));
+            return m * 64 + static_cast<size_t>(__builtin_ctzll(mots[m]));
+        }
+        return AUCUN;
+    }
+
+    /**
+     * Vrai si les deux ensembles (même taille) ont un indice en commun
+     */
+    bool intersecte(const EnsembleIndices& autre) const {
+        for (size_t r = 0; r < resume.size(); r++) {
+            uint64_t communs = resume[r] & autre.resume[r];
+            while (communs) {
+                size_t mot = r * 64 + static_cast<size_t>(__builtin_ctzll(communs));
+                if (mots[mot] & autre.mots[mot]) return true;
+                communs &= communs - 1;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * Plus petit indice commun aux deux ensembles (AUCUN si disjoints)
+     */
+    size_t getPremierCommun(const EnsembleIndices& autre) const {
+        for (size_t r = 0; r < resume.size(); r++) {
+            uint64_t communs = resume[r] & autre.resume[r];
+            while (communs) {
+                size_t mot = r * 64 + static_cast<size_t>(__builtin_ctzll(communs));
+                uint64_t bits = mots[mot] & autre.mots[mot];
+                if (bits) return mot * 64 + static_cast<size_t>(__builtin_ctzll(bits));
+                communs &= communs - 1;
+            }
+        }
+        return AUCUN;
+    }
+
+    bool estVide() const { return nombre == 0; }
+    size_t getNombre() const { return nombre; }
+    size_t getTaille() const { return taille; }
+};
+
+/**
+ * Blocs libres et équipes disponibles, tenus à jour par le moteur
+ *
+ * L'indice d'une ressource est sa position dans le vecteur du moteur
+ * (id - 1). Les vérifications de disponibilité et le choix de la première
+ * ressource libre ne parcourent plus les vecteurs.
+ *
+ * La compatibilité type d'opération × équipe est précalculée (un ensemble
+ * d'équipes par type): trouver une équipe libre compatible est une
+ * intersection de masques.
+ */
+class RessourcesLibres {
+private:
+    EnsembleIndices blocsLibres;
+    EnsembleIndices equipesLibres;
+    EnsembleIndices blocsEnPreparation;     // Réservés, opération pas encore commencée
+    std::array<EnsembleIndices, NOMBRE_TYPES_OPERATION> equipesParType;
+    bool specialisation;        // Au moins une équipe ne couvre pas tous les types
+    int blocsEnOperation;
+
+public:
+    RessourcesLibres() : specialisation(false), blocsEnOperation(0) {}
+
+    /**
+     * Reconstruit les ensembles à partir de l'état courant des ressources
+     */
+    void initialiser(const std::vector<BlocOperatoire*>& blocs,
+                     const std::vector<EquipeMedicale*>& equipes) {
+        blocsLibres.redimensionner(blocs.size());
+        blocsEnPreparation.redimensionner(blocs.size());
+        equipesLibres.redimensionner(equipes.size());
+        blocsEnOperation = 0;
+        specialisation = false;
+        for (auto& ensemble : equipesParType) ensemble.redimensionner(equipes.size());
+
+        for (size_t i = 0; i < blocs.size(); i++) {
+            if (!blocs[i]) continue;
+            if (blocs[i]->estDisponible()) blocsLibres.ajouter(i);
+            if (blocs[i]->estReserve()) blocsEnPreparation.ajouter(i);
+            if (blocs[i]->estOccupe()) blocsEnOperation++;
+        }
+        for (size_t i = 0; i < equipes.size(); i++) {
+            if (!equipes[i]) continue;
+            if (equipes[i]->estDisponible() && equipes[i]->estComplete()) {
+                equipesLibres.ajouter(i);
+            }
+
+            uint32_t compatibles = equipes[i]->getTypesOperationCompatibles();
+            if (compatibles != TOUS_TYPES_OPERATION) specialisation = true;
+            for (size_t t = 0; t < NOMBRE_TYPES_OPERATION; t++) {
+                if (compatibles & (1u << t)) equipesParType[t].ajouter(i);
+            }
+        }
+    }
+
+    /**
+     * Début d'opération: le bloc et l'équipe sont pris
+     */
+    void reserver(size_t indiceBloc, size_t indiceEquipe) {
+        blocsLibres.retirer(indiceBloc);
+        equipesLibres.retirer(indiceEquipe);
+        blocsEnOperation++;
+    }
+
+    /**
+     * Préparation d'un patient: bloc et équipe pris, opération pas encore commencée
+     */
+    void reserverPreparation(size_t indiceBloc, size_t indiceEquipe) {
+        blocsLibres.retirer(indiceBloc);
+        equipesLibres.retirer(indiceEquipe);
+        blocsEnPreparation.ajouter(indiceBloc);
+    }
+
+    /**
+     * Fin de préparation: l'opération commence
+     */
+    void commencerOperationPreparee(size_t indiceBloc) {
+        blocsEnPreparation.retirer(indiceBloc);
+        blocsEnOperation++;
+    }
+
+    /**
+     * Report du patient en préparation: bloc et équipe à nouveau libres
+     */
+    void annulerPreparation(size_t indiceBloc, size_t indiceEquipe) {
+        blocsEnPreparation.retirer(indiceBloc);
+        blocsLibres.ajouter(indiceBloc);
+        equipesLibres.ajouter(indiceEquipe);
+    }
+
+    /**
+     * Fin d'opération: le bloc passe en nettoyage (toujours indisponible)
+     */
+    void terminerOperation() {
+        if (blocsEnOperation > 0) blocsEnOperation--;
+    }
+
+    void libererBloc(size_t indiceBloc) { blocsLibres.ajouter(indiceBloc); }
+    void libererEquipe(size_t indiceEquipe) { equipesLibres.ajouter(indiceEquipe); }
+
+    size_t getPremierBlocLibre() const { return blocsLibres.getPremier(); }
+    size_t getPremiereEquipeLibre() const { return equipesLibres.getPremier(); }
+
+    /**
+     * Première équipe libre compatible avec le type (AUCUN s'il n'y en a pas)
+     */
+    size_t getPremiereEquipeCompatible(TypeOperation type) const {
+        if (!specialisation) return equipesLibres.getPremier();
+        return equipesParType[static_cast<size_t>(type)].getPremierCommun(equipesLibres);
+    }
+
+    /**
+     * Types d'opération qu'au moins une équipe libre peut prendre en charge
+     */
+    uint32_t getTypesServables() const {
+        if (equipesLibres.estVide()) return 0;
+        if (!specialisation) return TOUS_TYPES_OPERATION;
+
+        uint32_t masque = 0;
+        for (size_t t = 0; t < NOMBRE_TYPES_OPERATION; t++) {
+            if (equipesParType[t].intersecte(equipesLibres)) masque |= 1u << t;
+        }
+        return masque;
+    }
+
+    bool estSpecialise() const { return specialisation; }
+
+    /**
+     * Vrai si l'équipe peut opérer ce type
+     */
+    bool estCompatible(size_t indiceEquipe, TypeOperation type) const {
+        return !specialisation || equipesParType[static_cast<size_t>(type)].contient(indiceEquipe);
+    }
+
+    const EnsembleIndices& getBlocsEnPreparation() const { return blocsEnPreparation; }
+
+    int getNombreBlocsLibres() const { return static_cast<int>(blocsLibres.getNombre()); }
+    int getNombreEquipesLibres() const { return static_cast<int>(equipesLibres.getNombre()); }
+    int getNombreBlocsEnOperation() const { return blocsEnOperation; }
+
+    bool estBlocLibre(size_t indiceBloc) const { return blocsLibres.contient(indiceBloc); }
+    bool estEquipeLibre(size_t indiceEquipe) const { return equipesLibres.contient(indiceEquipe); }
+};
+
+} // namespace AutoMed
+
+#endif // RESSOURCES_LIBRES_HPP
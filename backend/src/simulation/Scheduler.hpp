@@ -2,12 +2,13 @@
 #define SCHEDULER_HPP
 
 #include <vector>
-#include <algorithm>
 #include "../models/Patient.hpp"
 #include "../models/BlocOperatoire.hpp"
 #include "../models/EquipeMedicale.hpp"
 #include "../models/SalleAttente.hpp"
 #include "../enums/AlgorithmeOrdonnancement.hpp"
+#include "../models/PolitiquesOrdonnancement.hpp"
+#include "RessourcesLibres.hpp"
 
 namespace AutoMed {
 
@@ -17,109 +18,70 @@ namespace AutoMed {
 class Scheduler {
 public:
     /**
-     * Sélectionne le prochain patient à opérer selon l'algorithme choisi
+     * Sélectionne le prochain patient à opérer selon la politique de la
+     * salle, parmi les types d'opération autorisés (masque de bits)
      * Retire le patient de la salle d'attente
      */
     static Patient* selectionnerProchainPatient(
-        SalleAttente* salle, 
-        AlgorithmeOrdonnancement algo
+        SalleAttente* salle,
+        uint32_t typesAutorises = TOUS_TYPES_OPERATION
     ) {
         if (!salle || salle->estVide()) {
             return nullptr;
         }
+        return salle->getProchainPatient(typesAutorises);
+    }
 
-        Patient* patient = nullptr;
-
-        switch (algo) {
-            case AlgorithmeOrdonnancement::FCFS:
-                patient = salle->getProchainPatientFCFS();
-                break;
-
-            case AlgorithmeOrdonnancement::PRIORITE:
-                patient = salle->getProchainPatientPriorite();
-                break;
-
-            case AlgorithmeOrdonnancement::SJF:
-                patient = salle->getProchainPatientSJF();
-                break;
-
-            default:
-                patient = salle->getProchainPatientFCFS();
-                break;
+    /**
+     * Variante spécialisée: la politique est un paramètre de compilation,
+     * aucun aiguillage ni appel virtuel sur le chemin de sélection
+     */
+    template <typename Politique>
+    static Patient* selectionnerProchainPatient(
+        SalleAttente* salle,
+        uint32_t typesAutorises = TOUS_TYPES_OPERATION
+    ) {
+        if (!salle || salle->estVide()) {
+            return nullptr;
         }
-
-        return patient;
+        return salle->template getProchainPatient<Politique>(typesAutorises);
     }
 
     /**
-     * Trouve un bloc opératoire disponible
-     * Retourne nullptr si aucun bloc n'est libre
+     * Premier bloc libre d'après les ensembles tenus à jour (sans parcours)
      */
     static BlocOperatoire* trouverBlocDisponible(
-        const std::vector<BlocOperatoire*>& blocs
+        const std::vector<BlocOperatoire*>& blocs,
+        const RessourcesLibres& ressources
     ) {
-        for (auto* bloc : blocs) {
-            if (bloc && bloc->estDisponible()) {
-                return bloc;
-            }
-        }
-        return nullptr;
+        size_t indice = ressources.getPremierBlocLibre();
+        return indice < blocs.size() ? blocs[indice] : nullptr;
     }
 
     /**
-     * Trouve une équipe médicale disponible
-     * Pour l'instant, retourne simplement la première équipe disponible
-     * Peut être étendu pour vérifier la compatibilité avec le type d'opération
+     * Première équipe disponible, complète et compatible avec le type
+     * d'opération, d'après l'index de compatibilité
      */
     static EquipeMedicale* trouverEquipeDisponible(
         const std::vector<EquipeMedicale*>& equipes,
+        const RessourcesLibres& ressources,
         TypeOperation typeOp
     ) {
-        // Version simple: première équipe disponible et complète
-        for (auto* equipe : equipes) {
-            if (equipe && equipe->estDisponible() && equipe->estComplete()) {
-                return equipe;
-            }
-        }
-        return nullptr;
+        size_t indice = ressources.getPremiereEquipeCompatible(typeOp);
+        return indice < equipes.size() ? equipes[indice] : nullptr;
     }
 
     /**
-     * Compte le nombre de blocs disponibles
-     */
-    static int compterBlocsDisponibles(const std::vector<BlocOperatoire*>& blocs) {
-        return std::count_if(blocs.begin(), blocs.end(),
-            [](BlocOperatoire* b) { return b && b->estDisponible(); });
-    }
-
-    /**
-     * Compte le nombre de blocs occupés
-     */
-    static int compterBlocsOccupes(const std::vector<BlocOperatoire*>& blocs) {
-        return std::count_if(blocs.begin(), blocs.end(),
-            [](BlocOperatoire* b) { return b && b->estOccupe(); });
-    }
-
-    /**
-     * Compte le nombre d'équipes disponibles
-     */
-    static int compterEquipesDisponibles(const std::vector<EquipeMedicale*>& equipes) {
-        return std::count_if(equipes.begin(), equipes.end(),
-            [](EquipeMedicale* e) { return e && e->estDisponible() && e->estComplete(); });
-    }
-
-    /**
-     * Vérifie si une assignation est possible
-     * (au moins 1 bloc libre ET 1 équipe disponible ET 1 patient en attente)
+     * Vérifie si une assignation est possible sans parcourir les ressources
+     * (un bloc libre ET un patient qu'une équipe libre peut opérer)
      */
     static bool assignationPossible(
-        const std::vector<BlocOperatoire*>& blocs,
-        const std::vector<EquipeMedicale*>& equipes,
+        const RessourcesLibres& ressources,
         SalleAttente* salle
     ) {
-        return compterBlocsDisponibles(blocs) > 0 &&
-               compterEquipesDisponibles(equipes) > 0 &&
-               salle && !salle->estVide();
+        return ressources.getNombreBlocsLibres() > 0 &&
+               salle && !salle->estVide() &&
+               salle->contientTypes(ressources.getTypesServables());
     }
 };
 
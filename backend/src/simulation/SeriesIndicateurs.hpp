@@ -0,0 +1,407 @@
+#ifndef SERIES_INDICATEURS_HPP
+#define SERIES_INDICATEURS_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <ctime>
+#include <mutex>
+#include <vector>
+#include <nlohmann/json.hpp>
+#include "../enums/IndicateurSerie.hpp"
+
+namespace AutoMed {
+
+/**
+ * Série d'un indicateur entier, une valeur par minute virtuelle
+ *
+ * L'état ne change qu'aux événements: la série est une suite de plages
+ * (écart à la plage précédente en zigzag, longueur en minutes), chaque
+ * nombre codé en entier de longueur variable (1 octet jusqu'à 127). Un
+ * point de reprise toutes les PLAGES_PAR_REPRISE plages permet de lire une
+ * plage de minutes sans tout décoder depuis le début.
+ */
+class SerieDelta {
+public:
+    static constexpr uint64_t PLAGES_PAR_REPRISE = 128;
+
+private:
+    struct Reprise {
+        int64_t minute;     // Première minute de la plage
+        size_t octet;       // Position de la plage dans octets
+        int32_t valeur;     // Valeur de la plage précédente (base de l'écart)
+    };
+
+    std::vector<uint8_t> octets;
+    std::vector<Reprise> reprises;
+    int32_t valeurCodee;        // Valeur de la dernière plage codée
+    int32_t valeurCourante;     // Plage ouverte (pas encore codée)
+    int64_t longueurCourante;
+    int64_t nombreMinutes;
+    uint64_t nombrePlages;
+
+    void ecrireEntier(uint64_t entier) {
+        while (entier >= 0x80) {
+            octets.push_back(static_cast<uint8_t>(entier | 0x80));
+            entier >>= 7;
+        }
+        octets.push_back(static_cast<uint8_t>(entier));
+    }
+
+    static uint64_t lireEntier(const uint8_t*& position) {
+        uint64_t entier = 0;
+        for (int decalage = 0; ; decalage += 7) {
+            uint8_t octet = *position++;
+            entier |= static_cast<uint64_t>(octet & 0x7F) << decalage;
+            if (!(octet & 0x80)) return entier;
+        }
+    }
+
+    void fermerPlage() {
+        if (longueurCourante == 0) return;
+
+        if (nombrePlages % PLAGES_PAR_REPRISE == 0) {
+            reprises.push_back(Reprise{nombreMinutes - longueurCourante, octets.size(), valeurCodee});
+        }
+        int64_t ecart = static_cast<int64_t>(valeurCourante) - valeurCodee;
+        ecrireEntier((static_cast<uint64_t>(ecart) << 1) ^ static_cast<uint64_t>(ecart >> 63));
+        ecrireEntier(static_cast<uint64_t>(longueurCourante));
+
+        valeurCodee = valeurCourante;
+        longueurCourante = 0;
+        nombrePlages++;
+    }
+
+public:
+    SerieDelta()
+        : valeurCodee(0), valeurCourante(0), longueurCourante(0), nombreMinutes(0), nombrePlages(0) {}
+
+    /**
+     * Ajoute nombre minutes à la valeur donnée
+     */
+    void ajouter(int32_t valeur, int64_t nombre) {
+        if (nombre <= 0) return;
+        if (longueurCourante > 0 && valeur != valeurCourante) fermerPlage();
+        valeurCourante = valeur;
+        longueurCourante += nombre;
+        nombreMinutes += nombre;
+    }
+
+    /**
+     * Appelle fonction(premiereMinute, valeur, longueur) pour chaque plage
+     * qui recouvre [debut, fin), découpée aux bornes
+     */
+    template <typename Fonction>
+    void parcourir(int64_t debut, int64_t fin, Fonction fonction) const {
+        fin = std::min(fin, nombreMinutes);
+        if (debut >= fin) return;
+
+        auto suivante = std::upper_bound(reprises.begin(), reprises.end(), debut,
+            [](int64_t minute, const Reprise& reprise) { return minute < reprise.minute; });
+        int64_t minute = 0;
+        int32_t valeur = 0;
+        const uint8_t* position = octets.data();
+        if (suivante != reprises.begin()) {
+            const Reprise& reprise = *(suivante - 1);
+            minute = reprise.minute;
+            valeur = reprise.valeur;
+            position += reprise.octet;
+        }
+
+        const uint8_t* finOctets = octets.data() + octets.size();
+        while (position < finOctets && minute < fin) {
+            uint64_t zigzag = lireEntier(position);
+            valeur += static_cast<int32_t>(static_cast<int64_t>(zigzag >> 1) ^ -static_cast<int64_t>(zigzag & 1));
+            int64_t longueur = static_cast<int64_t>(lireEntier(position));
+            if (minute + longueur > debut) {
+                int64_t premiere = std::max(minute, debut);
+                fonction(premiere, valeur, std::min(minute + longueur, fin) - premiere);
+            }
+            minute += longueur;
+        }
+
+        // Plage ouverte
+        if (longueurCourante > 0 && minute < fin) {
+            int64_t premiere = std::max(minute, debut);
+            fonction(premiere, valeurCourante, fin - premiere);
+        }
+    }
+
+    void vider() {
+        octets.clear();
+        reprises.clear();
+        valeurCodee = 0;
+        valeurCourante = 0;
+        longueurCourante = 0;
+        nombreMinutes = 0;
+        nombrePlages = 0;
+    }
+
+    int64_t getNombreMinutes() const { return nombreMinutes; }
+    uint64_t getNombrePlages() const { return nombrePlages + (longueurCourante > 0 ? 1 : 0); }
+    size_t getOctets() const { return octets.size() + reprises.size() * sizeof(Reprise); }
+};
+
+/**
+ * Agrégats d'une série par tranches de resolution minutes (min, max, somme)
+ */
+class NiveauAgregation {
+public:
+    struct Agregat {
+        int32_t min;
+        int32_t max;
+        int64_t somme;
+
+        void fusionner(const Agregat& autre) {
+            min = std::min(min, autre.min);
+            max = std::max(max, autre.max);
+            somme += autre.somme;
+        }
+    };
+
+private:
+    int64_t resolution;
+    std::vector<Agregat> agregats;     // Indice = minute / resolution
+
+public:
+    explicit NiveauAgregation(int64_t resolution = 1) : resolution(resolution) {}
+
+    /**
+     * Ouvre la tranche suivante avec sa première valeur (somme à compléter)
+     */
+    void ouvrir(int32_t valeur) { agregats.push_back(Agregat{valeur, valeur, 0}); }
+
+    Agregat& derniere() { return agregats.back(); }
+
+    /**
+     * Ajoute une tranche plus fine fermée qui commence à la minute premiere
+     * (les tranches arrivent dans l'ordre)
+     */
+    void fusionner(int64_t premiere, const Agregat& agregat) {
+        size_t indice = static_cast<size_t>(premiere / resolution);
+        if (indice == agregats.size()) {
+            agregats.push_back(agregat);
+        } else {
+            agregats[indice].fusionner(agregat);
+        }
+    }
+
+    void vider() { agregats.clear(); }
+
+    int64_t getResolution() const { return resolution; }
+    const std::vector<Agregat>& getAgregats() const { return agregats; }
+    size_t getOctets() const { return agregats.size() * sizeof(Agregat); }
+};
+
+/**
+ * Séries temporelles des indicateurs d'une simulation
+ *
+ * Une valeur par indicateur et par minute virtuelle depuis l'origine, codée
+ * en plages (SerieDelta), plus des agrégats à 15 min, 1 h et 1 jour pour
+ * servir une simulation entière en peu de points. Seule la tranche de 15 min
+ * ouverte est mise à jour à chaque enregistrement; elle est fusionnée dans
+ * les niveaux plus grossiers à sa fermeture, et ajoutée à leur dernière
+ * tranche à la lecture. Le moteur enregistre en tête avant d'avancer
+ * l'horloge; l'API lit depuis un autre thread: le verrou n'est pris qu'au
+ * passage d'une minute et à la lecture.
+ */
+class SeriesIndicateurs {
+public:
+    static constexpr size_t NOMBRE_NIVEAUX = 3;
+    static constexpr std::array<int64_t, NOMBRE_NIVEAUX> RESOLUTIONS_AGREGEES = {15, 60, 24 * 60};
+
+    using Valeurs = std::array<int32_t, NOMBRE_INDICATEURS_SERIE>;
+
+private:
+    time_t origine;                     // Minute 0 (0 tant que la simulation n'a pas démarré)
+    int64_t nombreMinutes;              // Minutes enregistrées [0, nombreMinutes)
+    int64_t finTranche;                 // Fin de la tranche fine ouverte (minute)
+    std::array<SerieDelta, NOMBRE_INDICATEURS_SERIE> series;
+    std::array<std::array<NiveauAgregation, NOMBRE_NIVEAUX>, NOMBRE_INDICATEURS_SERIE> niveaux;
+    mutable std::mutex verrou;
+
+    /**
+     * Résolution servie: celle demandée si elle existe, sinon la plus fine
+     * qui tient en pointsMax points
+     */
+    static int64_t choisirResolution(int64_t demandee, int64_t nombreMinutesPlage, size_t pointsMax) {
+        if (demandee == 1) return 1;
+        for (int64_t resolution : RESOLUTIONS_AGREGEES) {
+            if (resolution == demandee) return resolution;
+        }
+        if (nombreMinutesPlage <= static_cast<int64_t>(pointsMax)) return 1;
+        for (int64_t resolution : RESOLUTIONS_AGREGEES) {
+            if ((nombreMinutesPlage + resolution - 1) / resolution <= static_cast<int64_t>(pointsMax)) return resolution;
+        }
+        return RESOLUTIONS_AGREGEES.back();
+    }
+
+    /**
+     * Ferme la tranche fine courante (fusion dans les niveaux grossiers) et
+     * ouvre la suivante
+     */
+    void ouvrirTranche(const Valeurs& valeurs) {
+        int64_t premiere = finTranche - RESOLUTIONS_AGREGEES[0];
+        for (size_t i = 0; i < NOMBRE_INDICATEURS_SERIE; i++) {
+            if (finTranche > 0) {
+                const auto& fermee = niveaux[i][0].derniere();
+                for (size_t n = 1; n < NOMBRE_NIVEAUX; n++) niveaux[i][n].fusionner(premiere, fermee);
+            }
+            niveaux[i][0].ouvrir(valeurs[i]);
+        }
+        finTranche += RESOLUTIONS_AGREGEES[0];
+    }
+
+    /**
+     * Tranche indice du niveau, y compris la tranche fine encore ouverte
+     */
+    NiveauAgregation::Agregat lireAgregat(size_t indicateur, size_t niveau, size_t indice) const {
+        const auto& fines = niveaux[indicateur][0].getAgregats();
+        if (niveau == 0) return fines[indice];
+
+        const auto& agregats = niveaux[indicateur][niveau].getAgregats();
+        const auto& ouverte = fines.back();
+        int64_t premiereOuverte = finTranche - RESOLUTIONS_AGREGEES[0];
+        if (static_cast<size_t>(premiereOuverte / RESOLUTIONS_AGREGEES[niveau]) != indice) return agregats[indice];
+        if (indice >= agregats.size()) return ouverte;
+
+        NiveauAgregation::Agregat agregat = agregats[indice];
+        agregat.fusionner(ouverte);
+        return agregat;
+    }
+
+public:
+    SeriesIndicateurs() : origine(0), nombreMinutes(0), finTranche(0) {
+        for (auto& niveauxIndicateur : niveaux) {
+            for (size_t n = 0; n < NOMBRE_NIVEAUX; n++) {
+                niveauxIndicateur[n] = NiveauAgregation(RESOLUTIONS_AGREGEES[n]);
+            }
+        }
+    }
+
+    /**
+     * Vide les séries (mémoire gardée) et fixe la minute 0
+     */
+    void demarrer(time_t nouvelleOrigine) {
+        std::lock_guard<std::mutex> garde(verrou);
+        origine = nouvelleOrigine;
+        nombreMinutes = 0;
+        finTranche = 0;
+        for (size_t i = 0; i < NOMBRE_INDICATEURS_SERIE; i++) {
+            series[i].vider();
+            for (auto& niveau : niveaux[i]) niveau.vider();
+        }
+    }
+
+    /**
+     * Horodatage de la prochaine minute à enregistrer
+     */
+    time_t getHorodatageProchaineMinute() const {
+        return origine + static_cast<time_t>(nombreMinutes * 60);
+    }
+
+    /**
+     * Enregistre valeurs pour chaque minute pas encore enregistrée qui
+     * commence avant horodatage (l'état n'a pas changé depuis)
+     */
+    void enregistrerJusqua(time_t horodatage, const Valeurs& valeurs) {
+        if (origine == 0 || horodatage <= getHorodatageProchaineMinute()) return;
+
+        int64_t fin = (static_cast<int64_t>(horodatage - origine) + 59) / 60;
+        std::lock_guard<std::mutex> garde(verrou);
+        int64_t nombre = fin - nombreMinutes;
+        for (size_t i = 0; i < NOMBRE_INDICATEURS_SERIE; i++) {
+            series[i].ajouter(valeurs[i], nombre);
+        }
+
+        for (int64_t minute = nombreMinutes; minute < fin; ) {
+            if (minute == finTranche) ouvrirTranche(valeurs);
+            int64_t prises = std::min(fin, finTranche) - minute;
+            for (size_t i = 0; i < NOMBRE_INDICATEURS_SERIE; i++) {
+                auto& agregat = niveaux[i][0].derniere();
+                agregat.min = std::min(agregat.min, valeurs[i]);
+                agregat.max = std::max(agregat.max, valeurs[i]);
+                agregat.somme += static_cast<int64_t>(valeurs[i]) * prises;
+            }
+            minute += prises;
+        }
+        nombreMinutes = fin;
+    }
+
+    /**
+     * Plage [debutMinute, finMinute) en JSON; resolution 1 (valeurs brutes),
+     * 15, 60 ou 1440 (min, max, moyenne par tranche), ou 0 pour la plus fine
+     * qui tient en pointsMax points. finMinute < 0: jusqu'à la dernière minute
+     */
+    nlohmann::json extraire(int64_t debutMinute, int64_t finMinute, int64_t resolution, size_t pointsMax) const {
+        std::lock_guard<std::mutex> garde(verrou);
+
+        int64_t debut = std::clamp<int64_t>(debutMinute, 0, nombreMinutes);
+        int64_t fin = finMinute < 0 ? nombreMinutes : std::clamp<int64_t>(finMinute, debut, nombreMinutes);
+        int64_t resolutionServie = choisirResolution(resolution, fin - debut, std::max<size_t>(1, pointsMax));
+
+        nlohmann::json indicateurs = nlohmann::json::object();
+        if (resolutionServie == 1) {
+            for (size_t i = 0; i < NOMBRE_INDICATEURS_SERIE; i++) {
+                std::vector<int32_t> valeurs;
+                valeurs.reserve(static_cast<size_t>(fin - debut));
+                series[i].parcourir(debut, fin, [&](int64_t, int32_t valeur, int64_t longueur) {
+                    valeurs.insert(valeurs.end(), static_cast<size_t>(longueur), valeur);
+                });
+                indicateurs[indicateurSerieToString(static_cast<IndicateurSerie>(i))] = {{"valeurs", valeurs}};
+            }
+        } else {
+            size_t niveau = 0;
+            while (RESOLUTIONS_AGREGEES[niveau] != resolutionServie) niveau++;
+            debut = debut / resolutionServie * resolutionServie;
+
+            for (size_t i = 0; i < NOMBRE_INDICATEURS_SERIE; i++) {
+                std::vector<int32_t> minimums, maximums;
+                std::vector<double> moyennes;
+                for (int64_t minute = debut; minute < fin; minute += resolutionServie) {
+                    auto agregat = lireAgregat(i, niveau, static_cast<size_t>(minute / resolutionServie));
+                    int64_t minutesTranche = std::min(resolutionServie, nombreMinutes - minute);
+                    minimums.push_back(agregat.min);
+                    maximums.push_back(agregat.max);
+                    moyennes.push_back(static_cast<double>(agregat.somme) / minutesTranche);
+                }
+                indicateurs[indicateurSerieToString(static_cast<IndicateurSerie>(i))] = {
+                    {"min", minimums},
+                    {"max", maximums},
+                    {"moyenne", moyennes}
+                };
+            }
+        }
+
+        return nlohmann::json{
+            {"origine", origine},
+            {"nombreMinutes", nombreMinutes},
+            {"debutMinute", debut},
+            {"finMinute", fin},
+            {"resolution", resolutionServie},
+            {"indicateurs", indicateurs}
+        };
+    }
+
+    int64_t getNombreMinutes() const {
+        std::lock_guard<std::mutex> garde(verrou);
+        return nombreMinutes;
+    }
+
+    /**
+     * Mémoire occupée par les plages et les agrégats (octets)
+     */
+    size_t getOctets() const {
+        std::lock_guard<std::mutex> garde(verrou);
+        size_t total = 0;
+        for (size_t i = 0; i < NOMBRE_INDICATEURS_SERIE; i++) {
+            total += series[i].getOctets();
+            for (const auto& niveau : niveaux[i]) total += niveau.getOctets();
+        }
+        return total;
+    }
+};
+
+} // namespace AutoMed
+
+#endif // SERIES_INDICATEURS_HPP
@@ -3,10 +3,10 @@
 
 #include <string>
 #include <vector>
-#include <queue>
-#include <map>
+#include <deque>
 #include <ctime>
 #include <iostream>
+#include <sstream>
 #include <thread>
 #include <chrono>
 #include <nlohmann/json.hpp>
@@ -18,8 +18,18 @@
 #include "../models/SalleReveil.hpp"
 #include "../enums/EtatSimulation.hpp"
 #include "../enums/AlgorithmeOrdonnancement.hpp"
+#include "../enums/ModeCalendrier.hpp"
+#include "../enums/NiveauJournal.hpp"
+#include "ArenaSimulation.hpp"
+#include "RegistrePatients.hpp"
+#include "SeriesIndicateurs.hpp"
+#include "HorlogeVirtuelle.hpp"
 #include "Evenement.hpp"
+#include "CalendrierEvenements.hpp"
+#include "HistoriqueEvenements.hpp"
+#include "Journal.hpp"
 #include "GenerateurPatients.hpp"
+#include "PlanificateurAnticipation.hpp"
 #include "Scheduler.hpp"
 #include "Statistics.hpp"
 
@@ -34,11 +44,24 @@ struct ConfigSimulation {
     AlgorithmeOrdonnancement algorithme;
     int nombreBlocs;
     int nombreEquipes;
+    int nombreEquipesSpecialisees;  // Équipes limitées à une spécialité (les autres sont polyvalentes)
     int capaciteSalleAttente;
     int capaciteSalleReveil;
     double tauxArriveeHoraireUrgences;
     int nombrePatientsElectifs;
     double facteurVitesse;  // Facteur de vitesse: 0.0 = instantané, 1.0 = temps réel, 60.0 = 1 min virtuel = 1 sec réel
+    ModeCalendrier modeCalendrier;  // Structure du calendrier d'événements
+    uint64_t graine;                // Graine du générateur (même graine = même simulation)
+    uint64_t identifiantFlux;       // Flux aléatoire de la réplication (0..N-1 pour N réplications)
+    NiveauJournal niveauJournal;    // TRACE: chaque événement, INFO: cycle de vie, AUCUN: silencieux
+    int tailleHistorique;           // Nombre d'événements récents conservés pour l'API
+    int horizonAnticipationMinutes; // ANTICIPATION: arrivées programmées prises en compte
+    int budgetDecisionMicrosecondes;// ANTICIPATION: budget d'une décision (converti en évaluations)
+    bool mesurerDecisions;          // Mesure le temps de chaque décision (toujours vrai pour ANTICIPATION)
+    bool preemptionUrgences;        // Urgences servies d'abord: report d'électifs en préparation, réserve de blocs
+    int dureePreparationMinutes;    // Préemption: préparation avant incision, pendant laquelle un électif est reportable
+    int reserveUrgencesMax;         // Préemption: blocs gardés au plus pour les urgences
+    int fenetreReserveMinutes;      // Préemption: fenêtre d'estimation du taux d'arrivée des urgences
 
     ConfigSimulation()
         : nom("Simulation"),
@@ -46,11 +69,24 @@ struct ConfigSimulation {
           algorithme(AlgorithmeOrdonnancement::FCFS),
           nombreBlocs(3),
           nombreEquipes(3),
+          nombreEquipesSpecialisees(0),
           capaciteSalleAttente(50),
           capaciteSalleReveil(20),
           tauxArriveeHoraireUrgences(2.0),
           nombrePatientsElectifs(10),
-          facteurVitesse(0.0) {}  // Par défaut: instantané (compatibilité)
+          facteurVitesse(0.0),  // Par défaut: instantané (compatibilité)
+          modeCalendrier(ModeCalendrier::TAS_BINAIRE),
+          graine(42),
+          identifiantFlux(0),
+          niveauJournal(NiveauJournal::INFO),
+          tailleHistorique(50),
+          horizonAnticipationMinutes(120),
+          budgetDecisionMicrosecondes(500),
+          mesurerDecisions(false),
+          preemptionUrgences(false),
+          dureePreparationMinutes(15),
+          reserveUrgencesMax(1),
+          fenetreReserveMinutes(60) {}
 };
 
 /**
@@ -60,34 +96,59 @@ class SimulationEngine {
 private:
     int id;
     std::string nom;
-    time_t tempsSimulation;                           // Horloge virtuelle
-    time_t tempsDebutReel;                            // Timestamp réel du démarrage
+    HorlogeVirtuelle horloge;                         // Seule source du temps de la simulation
     time_t dernierTempsSimulation;                    // Dernier temps virtuel (pour calcul delta)
+    time_t horodatageFinSimulation;                   // Horizon virtuel (événement FIN_SIMULATION)
     EtatSimulation etat;
     AlgorithmeOrdonnancement algorithme;
     int dureeSimulationMinutes;
     double facteurVitesse;                            // Facteur de vitesse de simulation
+    Journal journal;                                  // Journal asynchrone (niveau par simulation)
     
-    // File d'événements (priority_queue)
-    std::priority_queue<Evenement> fileEvenements;
+    // Calendrier d'événements (pool d'enregistrements + tas de poignées)
+    CalendrierEvenements calendrier;
+    uint64_t nombreEvenementsTraites;
+    uint64_t nombreEvenementsPerimes;   // Extraits puis ignorés (ressource plus dans l'état attendu)
+    
+    // Mémoire des objets de la simulation (composants, membres, patients)
+    ArenaSimulation arena;
     
     // Composants hospitaliers
     SalleAttente* salleAttente;
     std::vector<BlocOperatoire*> blocsOperatoires;
     SalleReveil* salleReveil;
     std::vector<EquipeMedicale*> equipesDisponibles;
+    RessourcesLibres ressourcesLibres;                // Blocs libres / équipes disponibles (masques de bits)
+    void (SimulationEngine::*assignation)();          // tentativeAssignationAvec<Politique de l'algorithme>
+    PlanificateurAnticipation planificateur;          // Algorithme ANTICIPATION
+    std::vector<Patient*> arriveesProgrammees;        // Électifs triés par arrivée (connus à l'avance)
+    size_t prochaineArriveeProgrammee;                // Première arrivée programmée pas encore traitée
+    bool mesureDecisions;
+    uint64_t budgetDecisionNanosecondes;
+    
+    // Préemption des urgences
+    bool preemptionUrgences;
+    int dureePreparationMinutes;
+    int reserveUrgencesMax;
+    int fenetreReserveMinutes;
+    int reserveUrgences;                              // Blocs actuellement gardés pour les urgences
+    std::deque<time_t> arriveesUrgencesRecentes;      // Arrivées d'urgences dans la fenêtre
+    std::vector<PoigneeEvenement> evenementsBlocs;    // Par bloc: début, fin d'opération ou fin de nettoyage à venir
+    std::vector<uint64_t> sequencesPreparation;       // Par bloc réservé: rang d'attente du patient en préparation
+    std::deque<size_t> blocsBloques;                  // Blocs gardant un patient opéré, par fin d'opération (réveil plein)
     
-    // Tous les patients (pour gestion mémoire)
-    std::map<int, Patient*> tousLesPatients;
-    std::map<int, MembreMedical*> tousLesMembres;
+    // Tous les patients, par id (colonnes d'horodatages); ils vivent dans l'arène
+    RegistrePatients registre;
     
     // Générateur et stats
     GenerateurPatients* generateur;
     Statistics* stats;
     
-    // Historique d'événements récents (pour affichage)
-    std::vector<Evenement> historiqueEvenements;
-    const size_t MAX_HISTORIQUE = 50;
+    // Historique d'événements récents (pour affichage, vue JSON construite à la demande)
+    HistoriqueEvenements historiqueEvenements;
+    
+    // Indicateurs à chaque minute virtuelle (file, blocs, équipes, réveil)
+    SeriesIndicateurs series;
 
 public:
     /**
@@ -96,89 +157,110 @@ public:
     SimulationEngine(int simId, const ConfigSimulation& config)
         : id(simId),
           nom(config.nom),
-          tempsSimulation(std::time(nullptr)),
-          tempsDebutReel(0),
           dernierTempsSimulation(0),
+          horodatageFinSimulation(0),
           etat(EtatSimulation::CREATED),
           algorithme(config.algorithme),
           dureeSimulationMinutes(config.dureeSimulationMinutes),
-          facteurVitesse(config.facteurVitesse) {
+          facteurVitesse(config.facteurVitesse),
+          journal(config.niveauJournal, simId),
+          calendrier(config.modeCalendrier),
+          nombreEvenementsTraites(0),
+          nombreEvenementsPerimes(0),
+          prochaineArriveeProgrammee(0),
+          historiqueEvenements(static_cast<size_t>(std::max(1, config.tailleHistorique))) {
         
-        // Créer les composants
-        salleAttente = new SalleAttente(1, "Salle d'attente principale", config.capaciteSalleAttente);
-        salleReveil = new SalleReveil(1, "Salle de réveil", config.capaciteSalleReveil, 60);
+        horloge.demarrer(std::time(nullptr));
+        calendrier.setOrigine(horloge.getMaintenant());
+        creerComposants(config);
         
-        // Créer les blocs opératoires
-        for (int i = 0; i < config.nombreBlocs; i++) {
-            blocsOperatoires.push_back(
-                new BlocOperatoire(i + 1, "Bloc Opératoire " + std::to_string(i + 1), 15)
-            );
-        }
-        
-        // Créer les équipes médicales
-        for (int i = 0; i < config.nombreEquipes; i++) {
-            creerEquipeMedicale(i + 1);
-        }
-        
-        // Créer le générateur de patients
-        generateur = new GenerateurPatients(
-            config.tauxArriveeHoraireUrgences,
-            config.nombrePatientsElectifs
-        );
-        
-        // Créer les statistiques
-        stats = new Statistics();
-        
-        std::cout << "[SIMULATION] Simulation #" << id << " créée: " << nom << std::endl;
+        JOURNAL_INFO(journal, "[SIMULATION] Simulation #" << id << " créée: " << nom);
     }
 
     /**
-     * Destructeur
+     * Destructeur (l'arène détruit les composants, membres et patients)
+     */
+    ~SimulationEngine() {}
+
+    /**
+     * Réinitialise le moteur pour une nouvelle configuration
+     * Le calendrier et l'historique gardent leur mémoire: un même moteur
+     * peut enchaîner des milliers de simulations sans réallouer ses pools
      */
-    ~SimulationEngine() {
-        // Libérer la mémoire
-        delete salleAttente;
-        delete salleReveil;
-        delete generateur;
-        delete stats;
+    void reinitialiser(int simId, const ConfigSimulation& config) {
+        libererComposants();
+        
+        id = simId;
+        nom = config.nom;
+        horloge.demarrer(std::time(nullptr));
+        dernierTempsSimulation = 0;
+        horodatageFinSimulation = 0;
+        etat = EtatSimulation::CREATED;
+        algorithme = config.algorithme;
+        dureeSimulationMinutes = config.dureeSimulationMinutes;
+        facteurVitesse = config.facteurVitesse;
+        journal.setNiveau(config.niveauJournal);
+        journal.setSource(simId);
+        nombreEvenementsTraites = 0;
+        nombreEvenementsPerimes = 0;
         
-        for (auto* bloc : blocsOperatoires) delete bloc;
-        for (auto* equipe : equipesDisponibles) delete equipe;
-        for (auto& pair : tousLesPatients) delete pair.second;
-        for (auto& pair : tousLesMembres) delete pair.second;
+        if (calendrier.getMode() == config.modeCalendrier) {
+            calendrier.vider();
+        } else {
+            calendrier = CalendrierEvenements(config.modeCalendrier);
+        }
+        calendrier.setOrigine(horloge.getMaintenant());
+        historiqueEvenements.vider(static_cast<size_t>(std::max(1, config.tailleHistorique)));
+        
+        creerComposants(config);
+        
+        JOURNAL_INFO(journal, "[SIMULATION] Simulation #" << id << " réinitialisée: " << nom);
     }
 
     /**
      * Initialise la simulation avec les événements de départ
      */
     void initialiser() {
-        std::cout << "[SIMULATION] Initialisation de la simulation..." << std::endl;
+        JOURNAL_INFO(journal, "[SIMULATION] Initialisation de la simulation...");
         
         // Générer les patients électifs
-        auto patientsElectifs = generateur->genererPatientsElectifs(tempsSimulation, dureeSimulationMinutes);
+        horodatageFinSimulation = horloge.dansMinutes(dureeSimulationMinutes);
+        series.demarrer(horloge.getMaintenant());
+        
+        auto patientsElectifs = generateur->genererPatientsElectifs(horloge.getMaintenant(), dureeSimulationMinutes);
+        calendrier.reserver(patientsElectifs.size() + 64);
+        
+        // Patients attendus: électifs et urgences moyennes de l'horizon, avec marge
+        double urgencesPrevues = generateur->getTauxArriveeHoraireUrgences() * dureeSimulationMinutes / 60.0;
+        size_t patientsPrevus = patientsElectifs.size() + 16
+                              + static_cast<size_t>(std::min(1.25 * std::max(0.0, urgencesPrevues), 1e6));
+        registre.reserver(patientsPrevus);
+        salleAttente->reserverIds(patientsPrevus + 1);
+        arriveesProgrammees = patientsElectifs;
+        std::stable_sort(arriveesProgrammees.begin(), arriveesProgrammees.end(),
+            [](const Patient* a, const Patient* b) { return a->getHorodatageArrivee() < b->getHorodatageArrivee(); });
+        prochaineArriveeProgrammee = 0;
         for (auto* patient : patientsElectifs) {
-            tousLesPatients[patient->getId()] = patient;
+            registre.ajouter(patient);
             
             // Planifier leur arrivée
-            planifierEvenement(Evenement(
+            planifierEvenement(
                 TypeEvenement::ARRIVEE_PATIENT,
                 patient->getHorodatageArrivee(),
                 patient->getId()
-            ));
+            );
         }
         
         // Planifier la première arrivée d'urgence
         planifierProchaineArriveeUrgence();
         
         // Planifier la fin de simulation
-        planifierEvenement(Evenement(
-            TypeEvenement::FIN_SIMULATION,
-            tempsSimulation + (dureeSimulationMinutes * 60)
-        ));
+        planifierEvenement(TypeEvenement::FIN_SIMULATION, horodatageFinSimulation);
         
-        std::cout << "[SIMULATION] " << patientsElectifs.size() << " patients électifs programmés" << std::endl;
-        std::cout << "[SIMULATION] Durée: " << dureeSimulationMinutes << " minutes" << std::endl;
-        std::cout << "[SIMULATION] Algorithme: " << algorithmeToString(algorithme) << std::endl;
+        JOURNAL_INFO(journal, "[SIMULATION] " << patientsElectifs.size() << " patients électifs programmés");
+        JOURNAL_INFO(journal, "[SIMULATION] Durée: " << dureeSimulationMinutes << " minutes");
+        JOURNAL_INFO(journal, "[SIMULATION] Algorithme: " << algorithmeToString(algorithme));
+        JOURNAL_INFO(journal, "[SIMULATION] Calendrier: " << modeCalendrierToString(calendrier.getMode()));
     }
 
     /**
@@ -190,31 +272,30 @@ public:
         }
         
         etat = EtatSimulation::RUNNING;
-        tempsDebutReel = std::time(nullptr);
-        dernierTempsSimulation = tempsSimulation;  // Initialiser pour le premier événement
-        stats->demarrer(tempsSimulation);
+        dernierTempsSimulation = horloge.getMaintenant();  // Initialiser pour le premier événement
+        stats->demarrer(horloge.getMaintenant());
         
-        std::cout << "\n[SIMULATION] ===== DÉMARRAGE DE LA SIMULATION =====" << std::endl;
-        std::cout << "[SIMULATION] Horloge virtuelle: " << tempsSimulation << std::endl;
-        std::cout << "[SIMULATION] Facteur vitesse: ";
+        JOURNAL_INFO(journal, "\n[SIMULATION] ===== DÉMARRAGE DE LA SIMULATION =====");
+        JOURNAL_INFO(journal, "[SIMULATION] Horloge virtuelle: " << horloge.getMaintenant());
         if (facteurVitesse == 0.0) {
-            std::cout << "INSTANTANÉ" << std::endl;
+            JOURNAL_INFO(journal, "[SIMULATION] Facteur vitesse: INSTANTANÉ");
         } else if (facteurVitesse == 1.0) {
-            std::cout << "TEMPS RÉEL (1:1)" << std::endl;
+            JOURNAL_INFO(journal, "[SIMULATION] Facteur vitesse: TEMPS RÉEL (1:1)");
         } else {
-            std::cout << facteurVitesse << "x (1 min virtuel = " << (60.0 / facteurVitesse) << " sec réel)" << std::endl;
+            JOURNAL_INFO(journal, "[SIMULATION] Facteur vitesse: " << facteurVitesse
+                         << "x (1 min virtuel = " << (60.0 / facteurVitesse) << " sec réel)");
         }
         
         // Traiter tous les événements
-        while (etat == EtatSimulation::RUNNING && !fileEvenements.empty()) {
+        while (etat == EtatSimulation::RUNNING && !calendrier.estVide()) {
             step();
         }
         
-        if (fileEvenements.empty() && etat == EtatSimulation::RUNNING) {
+        if (calendrier.estVide() && etat == EtatSimulation::RUNNING) {
             etat = EtatSimulation::FINISHED;
-            stats->terminer(tempsSimulation);
-            std::cout << "\n[SIMULATION] ===== SIMULATION TERMINÉE =====" << std::endl;
-            std::cout << stats->toString() << std::endl;
+            stats->terminer(horloge.getMaintenant());
+            JOURNAL_INFO(journal, "\n[SIMULATION] ===== SIMULATION TERMINÉE =====");
+            journaliserResume();
         }
     }
 
@@ -222,13 +303,13 @@ public:
      * Avance d'un événement (pour exécution pas à pas)
      */
     void step() {
-        if (fileEvenements.empty()) {
+        if (calendrier.estVide()) {
             return;
         }
         
         // Récupérer le prochain événement
-        Evenement evt = fileEvenements.top();
-        fileEvenements.pop();
+        EvenementPlanifie evt = calendrier.extraire();
+        nombreEvenementsTraites++;
         
         // Calculer le délai réel si facteurVitesse > 0
         if (facteurVitesse > 0.0 && dernierTempsSimulation > 0) {
@@ -246,19 +327,18 @@ public:
             }
         }
         
+        // Minutes écoulées jusqu'à l'événement: état inchangé depuis le précédent
+        enregistrerSeries(evt.horodatage);
+        
         // Avancer l'horloge virtuelle
-        dernierTempsSimulation = tempsSimulation;
-        tempsSimulation = evt.horodatage;
+        dernierTempsSimulation = horloge.getMaintenant();
+        horloge.avancer(evt.horodatage);
         
         // Afficher l'événement
-        std::cout << "[" << getTempsEcouleMinutes() << "min] " << evt.toString() << std::endl;
-        
-        // Enrichir l'événement avec les métadonnées avant de le sauvegarder
-        Evenement enrichedEvt = evt;
-        enrichirEvenement(enrichedEvt);
+        JOURNAL_TRACE(journal, "[" << getTempsEcouleMinutes() << "min] " << evt.versEvenement().toString());
         
-        // Sauvegarder dans l'historique
-        ajouterAHistorique(enrichedEvt);
+        // Sauvegarder dans l'historique l'état observé avant traitement
+        ajouterAHistorique(evt);
         
         // Traiter l'événement
         traiterEvenement(evt);
@@ -273,7 +353,7 @@ public:
     void pause() {
         if (etat == EtatSimulation::RUNNING) {
             etat = EtatSimulation::PAUSED;
-            std::cout << "[SIMULATION] Simulation mise en pause" << std::endl;
+            JOURNAL_INFO(journal, "[SIMULATION] Simulation mise en pause");
         }
     }
 
@@ -283,7 +363,7 @@ public:
     void reprendre() {
         if (etat == EtatSimulation::PAUSED) {
             etat = EtatSimulation::RUNNING;
-            std::cout << "[SIMULATION] Simulation reprise" << std::endl;
+            JOURNAL_INFO(journal, "[SIMULATION] Simulation reprise");
         }
     }
 
@@ -292,65 +372,186 @@ public:
      */
     void arreter() {
         etat = EtatSimulation::STOPPED;
-        stats->terminer(tempsSimulation);
-        std::cout << "[SIMULATION] Simulation arrêtée" << std::endl;
-        std::cout << stats->toString() << std::endl;
+        enregistrerSeries(horloge.getMaintenant() + 1);
+        stats->terminer(horloge.getMaintenant());
+        JOURNAL_INFO(journal, "[SIMULATION] Simulation arrêtée");
+        journaliserResume();
     }
 
 private:
+    /**
+     * Résumé des statistiques, une ligne par message: un enregistrement du
+     * journal est limité à EnregistrementJournal::TAILLE_TEXTE caractères
+     */
+    void journaliserResume() {
+        if (!journal.estActif(NiveauJournal::INFO)) return;
+        std::istringstream resume(stats->toString());
+        std::string ligne;
+        while (std::getline(resume, ligne)) {
+            JOURNAL_INFO(journal, ligne);
+        }
+    }
+
+    /**
+     * Crée les salles, blocs, équipes, générateur et statistiques
+     */
+    void creerComposants(const ConfigSimulation& config) {
+        // Créer les composants
+        salleAttente = arena.creer<SalleAttente>(1, "Salle d'attente principale", config.capaciteSalleAttente, config.algorithme);
+
+        // Boucle d'assignation spécialisée sur la politique (choisie une fois)
+        assignation = avecPolitique(config.algorithme, [](auto politique) {
+            return &SimulationEngine::tentativeAssignationAvec<decltype(politique)>;
+        });
+        if (config.algorithme == AlgorithmeOrdonnancement::ANTICIPATION) {
+            assignation = &SimulationEngine::tentativeAssignationAnticipee;
+        }
+        mesureDecisions = config.mesurerDecisions || config.algorithme == AlgorithmeOrdonnancement::ANTICIPATION;
+        budgetDecisionNanosecondes = static_cast<uint64_t>(std::max(1, config.budgetDecisionMicrosecondes)) * 1000;
+        preemptionUrgences = config.preemptionUrgences;
+        dureePreparationMinutes = std::max(0, config.dureePreparationMinutes);
+        reserveUrgencesMax = std::max(0, std::min(config.reserveUrgencesMax, config.nombreBlocs - 1));
+        fenetreReserveMinutes = std::max(1, config.fenetreReserveMinutes);
+        reserveUrgences = 0;
+        arriveesUrgencesRecentes.clear();
+        blocsBloques.clear();
+        evenementsBlocs.assign(static_cast<size_t>(std::max(0, config.nombreBlocs)), PoigneeEvenement());
+        sequencesPreparation.assign(evenementsBlocs.size(), 0);
+        salleReveil = arena.creer<SalleReveil>(1, "Salle de réveil", config.capaciteSalleReveil, 60);
+        
+        // Créer les blocs opératoires
+        for (int i = 0; i < config.nombreBlocs; i++) {
+            blocsOperatoires.push_back(
+                arena.creer<BlocOperatoire>(i + 1, "Bloc Opératoire " + std::to_string(i + 1), 15)
+            );
+        }
+        
+        // Créer les équipes médicales
+        // Les premières équipes sont spécialisées (spécialités attribuées à tour de rôle)
+        for (int i = 0; i < config.nombreEquipes; i++) {
+            std::string specialite = SPECIALITE_CHIRURGIE_GENERALE;
+            if (i < config.nombreEquipesSpecialisees) {
+                specialite = specialiteChirurgicale(static_cast<TypeOperation>(i % NOMBRE_TYPES_OPERATION));
+            }
+            creerEquipeMedicale(i + 1, specialite);
+        }
+        ressourcesLibres.initialiser(blocsOperatoires, equipesDisponibles);
+        
+        std::vector<uint32_t> typesParEquipe;
+        for (auto* equipe : equipesDisponibles) typesParEquipe.push_back(equipe->getTypesOperationCompatibles());
+        planificateur.configurer(config.horizonAnticipationMinutes, config.budgetDecisionMicrosecondes,
+                                 blocsOperatoires.empty() ? 0 : blocsOperatoires.front()->getDureeNettoyageMinutes(),
+                                 typesParEquipe);
+        
+        // Créer le générateur de patients
+        generateur = arena.creer<GenerateurPatients>(
+            arena,
+            config.tauxArriveeHoraireUrgences,
+            config.nombrePatientsElectifs,
+            config.graine,
+            config.identifiantFlux
+        );
+        
+        // Créer les statistiques
+        stats = arena.creer<Statistics>(horloge);
+    }
+
+    /**
+     * Libère les composants et tous les patients/membres (l'arène garde sa mémoire)
+     */
+    void libererComposants() {
+        salleAttente = nullptr;
+        salleReveil = nullptr;
+        generateur = nullptr;
+        stats = nullptr;
+        
+        blocsOperatoires.clear();
+        equipesDisponibles.clear();
+        arriveesProgrammees.clear();
+        prochaineArriveeProgrammee = 0;
+        registre.vider();
+        
+        arena.reinitialiser();
+    }
+
+    /**
+     * Trouve un patient par ID (nullptr si inconnu)
+     */
+    Patient* trouverPatient(int patientId) const {
+        return registre.trouver(patientId);
+    }
+
     /**
      * Traite un événement
      */
-    void traiterEvenement(const Evenement& evt) {
+    void traiterEvenement(const EvenementPlanifie& evt) {
         switch (evt.type) {
             case TypeEvenement::ARRIVEE_PATIENT: {
-                Patient* patient = tousLesPatients[evt.patientId];
+                Patient* patient = trouverPatient(evt.patientId);
                 if (patient) {
                     arriveePatient(patient);
                 }
                 
                 // Si urgence, planifier la prochaine
                 if (patient && patient->getPriorite() == PrioritePatient::URGENCE) {
+                    if (preemptionUrgences) arriveesUrgencesRecentes.push_back(horloge.getMaintenant());
                     planifierProchaineArriveeUrgence();
                 }
                 break;
             }
             
+            case TypeEvenement::DEBUT_OPERATION: {
+                BlocOperatoire* bloc = evenementBlocAttendu(evt);
+                if (bloc && bloc->estReserve()) {
+                    commencerOperationPreparee(bloc);
+                } else {
+                    nombreEvenementsPerimes++;
+                }
+                break;
+            }
+            
             case TypeEvenement::FIN_OPERATION: {
-                BlocOperatoire* bloc = trouverBloc(evt.blocOperatoireId);
+                BlocOperatoire* bloc = evenementBlocAttendu(evt);
                 if (bloc && bloc->estOccupe()) {
                     Patient* patient = bloc->getPatientActuel();
                     terminerOperation(bloc);
                     
-                    // Planifier fin de nettoyage
-                    planifierEvenement(Evenement(
-                        TypeEvenement::FIN_NETTOYAGE_BLOC,
-                        tempsSimulation + (bloc->getDureeNettoyageMinutes() * 60),
-                        -1,
-                        bloc->getId()
-                    ));
-                    
-                    // Transférer en salle de réveil
-                    if (patient) {
-                        transfererEnSalleReveil(patient);
+                    // Réveil plein: le patient garde le bloc jusqu'à ce qu'un lit se libère
+                    if (patient && salleReveil->estPleine()) {
+                        bloquerBloc(bloc);
+                    } else {
+                        commencerNettoyage(bloc);
+                        if (patient) {
+                            transfererEnSalleReveil(patient);
+                        }
                     }
+                } else {
+                    nombreEvenementsPerimes++;
                 }
                 break;
             }
             
             case TypeEvenement::FIN_NETTOYAGE_BLOC: {
-                BlocOperatoire* bloc = trouverBloc(evt.blocOperatoireId);
-                if (bloc) {
+                BlocOperatoire* bloc = evenementBlocAttendu(evt);
+                if (!bloc) {
+                    nombreEvenementsPerimes++;
+                } else {
+                    EquipeMedicale* equipe = bloc->getEquipeAssignee();
                     bloc->terminerNettoyage();
-                    std::cout << "    → " << bloc->getNom() << " est maintenant LIBRE" << std::endl;
+                    ressourcesLibres.libererBloc(indiceRessource(bloc->getId()));
+                    if (equipe && equipe->estComplete()) {
+                        ressourcesLibres.libererEquipe(indiceRessource(equipe->getId()));
+                    }
+                    JOURNAL_TRACE(journal, "    → " << bloc->getNom() << " est maintenant LIBRE");
                 }
                 break;
             }
             
             case TypeEvenement::SORTIE_SALLE_REVEIL: {
-                Patient* patient = tousLesPatients[evt.patientId];
+                Patient* patient = trouverPatient(evt.patientId);
                 if (patient) {
                     libererPatientReveil(patient);
+                    debloquerBlocs();
                 }
                 break;
             }
@@ -365,6 +566,38 @@ private:
         }
     }
 
+    /**
+     * Bloc d'un événement de bloc qui vient d'être extrait. Seul l'événement
+     * dont la poignée est retenue est attendu: un autre (annulé sans poignée,
+     * bloc inconnu) est périmé et donne nullptr. La poignée est consommée.
+     */
+    BlocOperatoire* evenementBlocAttendu(const EvenementPlanifie& evt) {
+        BlocOperatoire* bloc = trouverBloc(evt.blocOperatoireId);
+        if (!bloc) return nullptr;
+        
+        PoigneeEvenement& attendu = evenementsBlocs[indiceRessource(bloc->getId())];
+        if (!attendu.estValide() || calendrier.estPlanifie(attendu)) return nullptr;
+        attendu = PoigneeEvenement();
+        return bloc;
+    }
+
+    /**
+     * Annule un événement planifié; la poignée est remise à zéro
+     */
+    bool annulerEvenement(PoigneeEvenement& poignee) {
+        bool annule = calendrier.annuler(poignee);
+        poignee = PoigneeEvenement();
+        return annule;
+    }
+
+    /**
+     * Déplace un événement planifié; la poignée est mise à jour (invalide si périmée)
+     */
+    bool replanifierEvenement(PoigneeEvenement& poignee, time_t horodatage) {
+        poignee = calendrier.replanifier(poignee, horodatage);
+        return poignee.estValide();
+    }
+
     /**
      * Arrivée d'un patient
      */
@@ -374,63 +607,285 @@ private:
         salleAttente->ajouterPatient(patient);
         stats->enregistrerArrivee(patient);
         
-        std::cout << "    → " << patient->getNomComplet() 
-                  << " (Priorité: " << prioriteToString(patient->getPriorite())
-                  << ", Type: " << typeOperationToString(patient->getTypeOperation())
-                  << ", Durée estimée: " << patient->getDureeEstimeeMinutes() << "min)" << std::endl;
+        JOURNAL_TRACE(journal, "    → " << patient->nomComplet() 
+                     << " (Priorité: " << prioriteToString(patient->getPriorite())
+                     << ", Type: " << typeOperationToString(patient->getTypeOperation())
+                     << ", Durée estimée: " << patient->getDureeEstimeeMinutes() << "min)");
     }
 
     /**
      * Tente d'assigner des patients aux blocs disponibles
      */
     void tentativeAssignation() {
-        while (Scheduler::assignationPossible(blocsOperatoires, equipesDisponibles, salleAttente)) {
+        bool mesurer = mesureDecisions && Scheduler::assignationPossible(ressourcesLibres, salleAttente);
+        auto debut = mesurer ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point();
+        
+        if (preemptionUrgences) placerUrgences();
+        (this->*assignation)();
+        if (!mesurer) return;
+        
+        auto nanosecondes = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - debut).count();
+        stats->enregistrerDecision(static_cast<uint64_t>(nanosecondes), budgetDecisionNanosecondes,
+                                   algorithme == AlgorithmeOrdonnancement::ANTICIPATION && planificateur.estBudgetAtteint());
+    }
+
+    /**
+     * Boucle d'assignation pour une politique connue à la compilation
+     */
+    template <typename Politique>
+    void tentativeAssignationAvec() {
+        while (ressourcesLibres.getNombreBlocsLibres() > reserveUrgences
+               && Scheduler::assignationPossible(ressourcesLibres, salleAttente)) {
             // Trouver un bloc disponible
-            BlocOperatoire* bloc = Scheduler::trouverBlocDisponible(blocsOperatoires);
+            BlocOperatoire* bloc = Scheduler::trouverBlocDisponible(blocsOperatoires, ressourcesLibres);
             if (!bloc) break;
             
             // Sélectionner le prochain patient
-            Patient* patient = Scheduler::selectionnerProchainPatient(salleAttente, algorithme);
+            Patient* patient = Scheduler::selectionnerProchainPatient<Politique>(
+                salleAttente, ressourcesLibres.getTypesServables());
             if (!patient) break;
             
             // Trouver une équipe disponible
             EquipeMedicale* equipe = Scheduler::trouverEquipeDisponible(
-                equipesDisponibles, 
+                equipesDisponibles,
+                ressourcesLibres,
                 patient->getTypeOperation()
             );
             if (!equipe) {
-                // Remettre le patient en attente
-                salleAttente->ajouterPatient(patient);
+                // Remettre le patient en attente, à son rang
+                salleAttente->ajouterPatient(patient, salleAttente->getSequenceDernierRetrait());
                 break;
             }
             
             // Démarrer l'opération
             demarrerOperation(bloc, patient, equipe);
         }
+
+        enregistrerBlocageSpecialisation();
     }
 
     /**
-     * Démarre une opération
+     * Assignation par anticipation: plan sur l'horizon (patients en attente et
+     * arrivées programmées), seuls les démarrages immédiats sont appliqués
+     */
+    void tentativeAssignationAnticipee() {
+        if (Scheduler::assignationPossible(ressourcesLibres, salleAttente)) {
+            planificateur.commencer(horloge.getMaintenant(), blocsOperatoires.size(), equipesDisponibles.size());
+            
+            // Libération prévue des ressources occupées (jamais avant l'instant suivant:
+            // un événement de libération au même instant n'est peut-être pas encore traité).
+            // Les blocs de la réserve d'urgence restent hors du plan.
+            int blocsReserves = reserveUrgences;
+            for (size_t i = 0; i < blocsOperatoires.size(); i++) {
+                BlocOperatoire* bloc = blocsOperatoires[i];
+                if (ressourcesLibres.estBlocLibre(i)) {
+                    if (blocsReserves > 0) {
+                        blocsReserves--;
+                        continue;
+                    }
+                    planificateur.setLiberationBloc(i, horloge.getMaintenant());
+                    continue;
+                }
+                
+                time_t liberation = PlanificateurAnticipation::JAMAIS;
+                time_t nettoyage = static_cast<time_t>(bloc->getDureeNettoyageMinutes()) * 60;
+                if ((bloc->estOccupe() || bloc->estReserve()) && bloc->getPatientActuel()) {
+                    liberation = bloc->getHorodatageDebutOperation()
+                               + static_cast<time_t>(bloc->getPatientActuel()->getDureeEstimeeMinutes()) * 60 + nettoyage;
+                } else if (bloc->getEtat() == EtatBlocOperatoire::NETTOYAGE) {
+                    liberation = bloc->getHorodatageFinOperation() + nettoyage;
+                }
+                // Bloc bloqué (réveil plein): libération inconnue, jamais dans le plan
+                if (liberation != PlanificateurAnticipation::JAMAIS) {
+                    liberation = std::max(liberation, horloge.getMaintenant() + 1);
+                }
+                planificateur.setLiberationBloc(i, liberation);
+                
+                EquipeMedicale* equipe = bloc->getEquipeAssignee();
+                if (equipe && equipe->estComplete()) {
+                    planificateur.setLiberationEquipe(indiceRessource(equipe->getId()), liberation);
+                }
+            }
+            for (size_t i = 0; i < equipesDisponibles.size(); i++) {
+                if (ressourcesLibres.estEquipeLibre(i)) planificateur.setLiberationEquipe(i, horloge.getMaintenant());
+            }
+            
+            // Candidats: salle d'attente et arrivées programmées de l'horizon
+            salleAttente->parcourirPatients([this](Patient* patient, uint64_t sequence) {
+                planificateur.ajouterPatientEnAttente(patient, sequence);
+            });
+            while (prochaineArriveeProgrammee < arriveesProgrammees.size()
+                   && arriveesProgrammees[prochaineArriveeProgrammee]->getHorodatageArrivee() <= horloge.getMaintenant()) {
+                prochaineArriveeProgrammee++;
+            }
+            time_t finHorizon = horloge.getMaintenant() + planificateur.getHorizonSecondes();
+            for (size_t i = prochaineArriveeProgrammee; i < arriveesProgrammees.size()
+                 && i - prochaineArriveeProgrammee < PlanificateurAnticipation::MAX_CANDIDATS_PROGRAMMES; i++) {
+                if (arriveesProgrammees[i]->getHorodatageArrivee() > finHorizon) break;
+                planificateur.ajouterArriveeProgrammee(arriveesProgrammees[i]);
+            }
+            
+            for (const auto& affectation : planificateur.planifier()) {
+                Patient* patient = salleAttente->retirerPatient(affectation.patient->getId());
+                demarrerOperation(blocsOperatoires[affectation.indiceBloc], patient,
+                                  equipesDisponibles[affectation.indiceEquipe]);
+            }
+        }
+        
+        enregistrerBlocageSpecialisation();
+    }
+
+    /**
+     * Bloc et équipe libres, patients en attente, mais aucun couple compatible
+     * (un bloc gardé pour une arrivée programmée n'est pas un blocage)
+     */
+    void enregistrerBlocageSpecialisation() {
+        bool blocageSpecialisation = ressourcesLibres.getNombreBlocsLibres() > reserveUrgences
+                                  && ressourcesLibres.getNombreEquipesLibres() > 0
+                                  && !salleAttente->estVide()
+                                  && !salleAttente->contientTypes(ressourcesLibres.getTypesServables());
+        stats->enregistrerBlocageSpecialisation(blocageSpecialisation, horloge.getMaintenant());
+    }
+
+    /**
+     * Urgences d'abord (mode préemption): chaque urgence en attente prend un
+     * bloc libre, réserve comprise, sinon le bloc d'un électif en préparation
+     */
+    void placerUrgences() {
+        mettreAJourReserveUrgences();
+        
+        while (salleAttente->compterPatientsPriorite(PrioritePatient::URGENCE) > 0) {
+            if (ressourcesLibres.getNombreBlocsLibres() > 0) {
+                Patient* urgence = salleAttente->getProchaineUrgence(ressourcesLibres.getTypesServables());
+                if (urgence) {
+                    BlocOperatoire* bloc = Scheduler::trouverBlocDisponible(blocsOperatoires, ressourcesLibres);
+                    EquipeMedicale* equipe = Scheduler::trouverEquipeDisponible(
+                        equipesDisponibles, ressourcesLibres, urgence->getTypeOperation());
+                    demarrerOperation(bloc, urgence, equipe);
+                    continue;
+                }
+            }
+            if (!reporterPreparation()) break;
+        }
+    }
+    
+    /**
+     * Réserve d'urgence: autant de blocs que d'urgences arrivées pendant la
+     * dernière fenêtre (estimation des arrivées de la fenêtre suivante), bornée
+     */
+    void mettreAJourReserveUrgences() {
+        time_t limite = horloge.getMaintenant() - static_cast<time_t>(fenetreReserveMinutes) * 60;
+        while (!arriveesUrgencesRecentes.empty() && arriveesUrgencesRecentes.front() <= limite) {
+            arriveesUrgencesRecentes.pop_front();
+        }
+        reserveUrgences = std::min(reserveUrgencesMax, static_cast<int>(arriveesUrgencesRecentes.size()));
+    }
+    
+    /**
+     * Reporte un électif en préparation dont le bloc peut recevoir la
+     * première urgence en attente (avec son équipe ou une équipe libre
+     * compatible): son début d'opération est annulé, il retourne en attente
+     */
+    bool reporterPreparation() {
+        Patient* urgence = salleAttente->consulterProchaineUrgence();
+        if (!urgence || salleAttente->estPleine()) return false;
+        
+        TypeOperation type = urgence->getTypeOperation();
+        bool equipeLibreCompatible = ressourcesLibres.getPremiereEquipeCompatible(type) != EnsembleIndices::AUCUN;
+        const EnsembleIndices& prepares = ressourcesLibres.getBlocsEnPreparation();
+        for (size_t i = prepares.getPremier(); i != EnsembleIndices::AUCUN; i = prepares.getSuivant(i)) {
+            BlocOperatoire* bloc = blocsOperatoires[i];
+            EquipeMedicale* equipe = bloc->getEquipeAssignee();
+            if (!equipe) continue;
+            size_t indiceEquipe = indiceRessource(equipe->getId());
+            if (!equipeLibreCompatible && !ressourcesLibres.estCompatible(indiceEquipe, type)) continue;
+            
+            annulerEvenement(evenementsBlocs[i]);
+            Patient* reporte = bloc->annulerReservation();
+            ressourcesLibres.annulerPreparation(i, indiceEquipe);
+            salleAttente->ajouterPatient(reporte, sequencesPreparation[i]);
+            stats->enregistrerReport();
+            
+            JOURNAL_TRACE(journal, "    → " << reporte->nomComplet() << " reporté (" << bloc->getNom()
+                         << " libéré pour " << urgence->nomComplet() << ")");
+            return true;
+        }
+        return false;
+    }
+
+    /**
+     * Démarre une opération (en mode préemption, un patient non urgent passe
+     * d'abord par la préparation, pendant laquelle il peut être reporté)
      */
     void demarrerOperation(BlocOperatoire* bloc, Patient* patient, EquipeMedicale* equipe) {
         if (!bloc || !patient || !equipe) return;
         
-        bloc->commencerOperation(patient, equipe, tempsSimulation);
+        if (preemptionUrgences && dureePreparationMinutes > 0 && patient->getPriorite() != PrioritePatient::URGENCE) {
+            preparerOperation(bloc, patient, equipe);
+            return;
+        }
+        
+        if (!bloc->commencerOperation(patient, equipe, horloge.getMaintenant())) return;
+        ressourcesLibres.reserver(indiceRessource(bloc->getId()), indiceRessource(equipe->getId()));
+        lancerOperation(bloc, patient, equipe);
+    }
+
+    /**
+     * Réserve bloc et équipe et planifie le début d'opération après la préparation
+     * (le patient vient de sortir de la salle: son rang est gardé en cas de report)
+     */
+    void preparerOperation(BlocOperatoire* bloc, Patient* patient, EquipeMedicale* equipe) {
+        time_t debutPrevu = horloge.dansMinutes(dureePreparationMinutes);
+        if (!bloc->reserver(patient, equipe, debutPrevu)) return;
+        
+        size_t indiceBloc = indiceRessource(bloc->getId());
+        sequencesPreparation[indiceBloc] = salleAttente->getSequenceDernierRetrait();
+        ressourcesLibres.reserverPreparation(indiceBloc, indiceRessource(equipe->getId()));
+        evenementsBlocs[indiceBloc] = planifierEvenement(
+            TypeEvenement::DEBUT_OPERATION,
+            debutPrevu,
+            patient->getId(),
+            bloc->getId(),
+            equipe->getId()
+        );
+        
+        JOURNAL_TRACE(journal, "    → Préparation: " << patient->nomComplet()
+                     << " | " << bloc->getNom() << " | début dans " << dureePreparationMinutes << "min");
+    }
+
+    /**
+     * Fin de préparation: l'opération réservée commence
+     */
+    void commencerOperationPreparee(BlocOperatoire* bloc) {
+        Patient* patient = bloc->getPatientActuel();
+        EquipeMedicale* equipe = bloc->getEquipeAssignee();
+        if (!bloc->commencerOperationReservee(horloge.getMaintenant())) return;
+        
+        ressourcesLibres.commencerOperationPreparee(indiceRessource(bloc->getId()));
+        lancerOperation(bloc, patient, equipe);
+    }
+
+    /**
+     * Opération commencée: statistiques et fin d'opération planifiée
+     */
+    void lancerOperation(BlocOperatoire* bloc, Patient* patient, EquipeMedicale* equipe) {
+        registre.enregistrerDebutOperation(patient->getId(), patient->getHorodatageDebutOperation());
         stats->enregistrerDebutOperation(patient);
         
-        std::cout << "    → Opération démarrée: " << patient->getNomComplet()
-                  << " | " << bloc->getNom() 
-                  << " | " << equipe->getNom()
-                  << " | Durée: " << patient->getDureeEstimeeMinutes() << "min" << std::endl;
+        JOURNAL_TRACE(journal, "    → Opération démarrée: " << patient->nomComplet()
+                     << " | " << bloc->getNom() 
+                     << " | " << equipe->getNom()
+                     << " | Durée: " << patient->getDureeEstimeeMinutes() << "min");
         
         // Planifier la fin de l'opération
-        planifierEvenement(Evenement(
+        evenementsBlocs[indiceRessource(bloc->getId())] = planifierEvenement(
             TypeEvenement::FIN_OPERATION,
-            tempsSimulation + (patient->getDureeEstimeeMinutes() * 60),
+            horloge.dansMinutes(patient->getDureeEstimeeMinutes()),
             patient->getId(),
             bloc->getId(),
             equipe->getId()
-        ));
+        );
     }
 
     /**
@@ -440,12 +895,55 @@ private:
         if (!bloc) return;
         
         Patient* patient = bloc->getPatientActuel();
-        bloc->terminerOperation(tempsSimulation);
+        if (bloc->terminerOperation(horloge.getMaintenant())) {
+            ressourcesLibres.terminerOperation();
+        }
         
         if (patient) {
+            registre.enregistrerFinOperation(patient->getId(), patient->getHorodatageFinOperation());
             stats->enregistrerFinOperation(patient);
-            std::cout << "    → Opération terminée: " << patient->getNomComplet() 
-                      << " | Durée réelle: " << patient->getDureeReelleMinutes() << "min" << std::endl;
+            JOURNAL_TRACE(journal, "    → Opération terminée: " << patient->nomComplet() 
+                         << " | Durée réelle: " << patient->getDureeReelleMinutes() << "min");
+        }
+    }
+
+    /**
+     * Planifie la fin de nettoyage du bloc (l'équipe est libérée avec lui)
+     */
+    void commencerNettoyage(BlocOperatoire* bloc) {
+        evenementsBlocs[indiceRessource(bloc->getId())] = planifierEvenement(
+            TypeEvenement::FIN_NETTOYAGE_BLOC,
+            horloge.dansMinutes(bloc->getDureeNettoyageMinutes()),
+            -1,
+            bloc->getId()
+        );
+    }
+
+    /**
+     * Salle de réveil pleine: le bloc garde le patient et son équipe, en file
+     * derrière les blocs déjà bloqués
+     */
+    void bloquerBloc(BlocOperatoire* bloc) {
+        if (!bloc->bloquer(horloge.getMaintenant())) return;
+        
+        blocsBloques.push_back(indiceRessource(bloc->getId()));
+        JOURNAL_TRACE(journal, "    → " << bloc->getNom() << " BLOQUÉ: " << bloc->getPatientActuel()->nomComplet()
+                     << " attend un lit de réveil");
+    }
+
+    /**
+     * Lits de réveil libres: les premiers blocs bloqués y envoient leur patient
+     * et commencent leur nettoyage (en O(1) par bloc, sans parcours)
+     */
+    void debloquerBlocs() {
+        while (!blocsBloques.empty() && !salleReveil->estPleine()) {
+            BlocOperatoire* bloc = blocsOperatoires[blocsBloques.front()];
+            blocsBloques.pop_front();
+            
+            Patient* patient = bloc->getPatientActuel();
+            stats->enregistrerBlocageReveil(bloc->debloquer(horloge.getMaintenant()));
+            commencerNettoyage(bloc);
+            transfererEnSalleReveil(patient);
         }
     }
 
@@ -455,15 +953,15 @@ private:
     void transfererEnSalleReveil(Patient* patient) {
         if (!patient || !salleReveil) return;
         
-        if (salleReveil->ajouterPatient(patient)) {
-            std::cout << "    → " << patient->getNomComplet() << " transféré en salle de réveil" << std::endl;
+        if (salleReveil->ajouterPatient(patient, horloge.getMaintenant())) {
+            JOURNAL_TRACE(journal, "    → " << patient->nomComplet() << " transféré en salle de réveil");
             
-            // Planifier la sortie
-            planifierEvenement(Evenement(
+            // Planifier la sortie à l'heure prévue par la salle (durée de réveil par défaut)
+            planifierEvenement(
                 TypeEvenement::SORTIE_SALLE_REVEIL,
-                tempsSimulation + (60 * 60),  // 60 minutes de réveil
+                salleReveil->trouverPatient(patient->getId())->getHorodatageSortiePrevue(),
                 patient->getId()
-            ));
+            );
         }
     }
 
@@ -473,10 +971,11 @@ private:
     void libererPatientReveil(Patient* patient) {
         if (!patient || !salleReveil) return;
         
-        salleReveil->retirerPatient(patient->getId());
-        stats->enregistrerSortie(patient);
+        salleReveil->retirerPatient(patient->getId(), horloge.getMaintenant());
+        registre.enregistrerSortie(patient->getId(), horloge.getMaintenant());
+        stats->enregistrerSortie(patient, horloge.getMaintenant());
         
-        std::cout << "    → " << patient->getNomComplet() << " quitte l'hôpital" << std::endl;
+        JOURNAL_TRACE(journal, "    → " << patient->nomComplet() << " quitte l'hôpital");
     }
 
     /**
@@ -484,136 +983,166 @@ private:
      */
     void planifierProchaineArriveeUrgence() {
         int delaiMinutes = generateur->calculerProchainDelaiArriveeMinutes();
-        time_t prochainTimestamp = tempsSimulation + (delaiMinutes * 60);
+        time_t prochainTimestamp = horloge.dansMinutes(delaiMinutes);
         
         // Ne pas dépasser la durée de simulation
-        if (prochainTimestamp > tempsDebutReel + (dureeSimulationMinutes * 60)) {
+        if (prochainTimestamp > horodatageFinSimulation) {
             return;
         }
         
-        // Créer le patient urgence
-        Patient* patient = generateur->genererPatientUrgence();
-        // Définir son horodatage d'arrivée avec le temps virtuel
-        patient->setHorodatageArrivee(prochainTimestamp);
-        tousLesPatients[patient->getId()] = patient;
+        // Créer le patient urgence (arrivée en temps virtuel)
+        Patient* patient = generateur->genererPatientUrgence(prochainTimestamp);
+        registre.ajouter(patient);
         
         // Planifier son arrivée
-        planifierEvenement(Evenement(
+        planifierEvenement(
             TypeEvenement::ARRIVEE_PATIENT,
             prochainTimestamp,
             patient->getId()
-        ));
+        );
     }
 
     /**
-     * Planifie un événement
+     * Planifie un événement dans le calendrier
      */
-    void planifierEvenement(const Evenement& evt) {
-        fileEvenements.push(evt);
+    PoigneeEvenement planifierEvenement(TypeEvenement type, time_t horodatage,
+                                        int patientId = -1, int blocId = -1, int equipeId = -1) {
+        return calendrier.planifier(type, horodatage, patientId, blocId, equipeId);
     }
 
     /**
-     * Ajoute un événement à l'historique
+     * Ajoute un événement à l'historique (enregistrement compact)
      */
-    void ajouterAHistorique(const Evenement& evt) {
-        historiqueEvenements.push_back(evt);
-        if (historiqueEvenements.size() > MAX_HISTORIQUE) {
-            historiqueEvenements.erase(historiqueEvenements.begin());
+    void ajouterAHistorique(const EvenementPlanifie& evt) {
+        EvenementHistorique entree;
+        entree.evenement = evt;
+        entree.tempsEcouleMinutes = getTempsEcouleMinutes();
+        entree.dureeReelleMinutes = 0;
+        entree.etatBloc = EtatBlocOperatoire::LIBRE;
+        entree.equipeDisponible = false;
+        
+        if (evt.patientId >= 0) {
+            Patient* patient = trouverPatient(evt.patientId);
+            if (patient) entree.dureeReelleMinutes = patient->getDureeReelleMinutes();
+        }
+        if (evt.blocOperatoireId >= 0) {
+            BlocOperatoire* bloc = trouverBloc(evt.blocOperatoireId);
+            if (bloc) entree.etatBloc = bloc->getEtat();
         }
+        if (evt.equipeId >= 0) {
+            EquipeMedicale* equipe = trouverEquipe(evt.equipeId);
+            if (equipe) entree.equipeDisponible = equipe->estDisponible();
+        }
+        
+        historiqueEvenements.ajouter(entree);
     }
 
     /**
-     * Enrichit un événement avec les métadonnées détaillées
+     * Construit la vue JSON d'une entrée d'historique (métadonnées détaillées)
      */
-    void enrichirEvenement(Evenement& evt) {
+    Evenement enrichirEvenement(const EvenementHistorique& entree) const {
+        const EvenementPlanifie& planifie = entree.evenement;
+        Evenement evt = planifie.versEvenement();
+        evt.numero = entree.numero;
         nlohmann::json meta = nlohmann::json::object();
         
         // Ajouter les informations du patient
-        if (evt.patientId >= 0 && tousLesPatients.count(evt.patientId) > 0) {
-            Patient* patient = tousLesPatients[evt.patientId];
-            meta["patient"] = {
-                {"id", patient->getId()},
-                {"nom", patient->getNomComplet()},
-                {"priorite", prioriteToString(patient->getPriorite())},
-                {"typeOperation", typeOperationToString(patient->getTypeOperation())},
-                {"dureeEstimee", patient->getDureeEstimeeMinutes()},
-                {"dureeReelle", patient->getDureeReelleMinutes()}
-            };
+        if (planifie.patientId >= 0) {
+            Patient* patient = trouverPatient(planifie.patientId);
+            if (patient) {
+                meta["patient"] = {
+                    {"id", patient->getId()},
+                    {"nom", patient->getNomComplet()},
+                    {"priorite", prioriteToString(patient->getPriorite())},
+                    {"typeOperation", typeOperationToString(patient->getTypeOperation())},
+                    {"dureeEstimee", patient->getDureeEstimeeMinutes()},
+                    {"dureeReelle", entree.dureeReelleMinutes}
+                };
+            }
         }
         
         // Ajouter les informations du bloc
-        if (evt.blocOperatoireId >= 0) {
-            BlocOperatoire* bloc = trouverBloc(evt.blocOperatoireId);
+        if (planifie.blocOperatoireId >= 0) {
+            BlocOperatoire* bloc = trouverBloc(planifie.blocOperatoireId);
             if (bloc) {
                 meta["bloc"] = {
                     {"id", bloc->getId()},
                     {"nom", bloc->getNom()},
-                    {"etat", etatBlocToString(bloc->getEtat())}
+                    {"etat", etatBlocToString(entree.etatBloc)}
                 };
             }
         }
         
         // Ajouter les informations de l'équipe
-        if (evt.equipeId >= 0) {
-            EquipeMedicale* equipe = trouverEquipe(evt.equipeId);
+        if (planifie.equipeId >= 0) {
+            EquipeMedicale* equipe = trouverEquipe(planifie.equipeId);
             if (equipe) {
                 meta["equipe"] = {
                     {"id", equipe->getId()},
                     {"nom", equipe->getNom()},
-                    {"disponible", equipe->estDisponible()}
+                    {"disponible", entree.equipeDisponible}
                 };
             }
         }
         
         // Ajouter le temps de simulation
-        meta["tempsSimulation"] = getTempsEcouleMinutes();
+        meta["tempsSimulation"] = entree.tempsEcouleMinutes;
         
         evt.metadata = meta;
+        return evt;
     }
 
     /**
      * Crée une équipe médicale complète
      */
-    void creerEquipeMedicale(int equipeId) {
-        EquipeMedicale* equipe = new EquipeMedicale(equipeId, "Équipe " + std::to_string(equipeId));
+    void creerEquipeMedicale(int equipeId, const std::string& specialiteChirurgien) {
+        EquipeMedicale* equipe = arena.creer<EquipeMedicale>(equipeId, "Équipe " + std::to_string(equipeId));
         
         // Créer les membres
         int baseId = equipeId * 10;
         
-        MembreMedical* chirurgien = new MembreMedical(
+        MembreMedical* chirurgien = arena.creer<MembreMedical>(
             baseId + 1, 
             "Chirurgien", 
             "Dr", 
-            "Chirurgie Générale"
+            specialiteChirurgien
         );
-        tousLesMembres[chirurgien->id] = chirurgien;
         equipe->setChirurgien(chirurgien);
         
-        MembreMedical* anesthesiste = new MembreMedical(
+        MembreMedical* anesthesiste = arena.creer<MembreMedical>(
             baseId + 2, 
             "Anesthésiste", 
             "Dr", 
             "Anesthésie"
         );
-        tousLesMembres[anesthesiste->id] = anesthesiste;
         equipe->setAnesthesiste(anesthesiste);
         
-        MembreMedical* infirmier = new MembreMedical(
+        MembreMedical* infirmier = arena.creer<MembreMedical>(
             baseId + 3, 
             "Infirmier", 
             "IDE", 
             "Bloc Opératoire"
         );
-        tousLesMembres[infirmier->id] = infirmier;
         equipe->ajouterInfirmier(infirmier);
         
         equipesDisponibles.push_back(equipe);
     }
 
+    /**
+     * Position d'un bloc ou d'une équipe dans son vecteur (ids attribués à partir de 1)
+     */
+    static size_t indiceRessource(int id) {
+        return static_cast<size_t>(id - 1);
+    }
+
     /**
      * Trouve un bloc par ID
      */
-    BlocOperatoire* trouverBloc(int blocId) {
+    BlocOperatoire* trouverBloc(int blocId) const {
+        size_t indice = indiceRessource(blocId);
+        if (indice < blocsOperatoires.size() && blocsOperatoires[indice]->getId() == blocId) {
+            return blocsOperatoires[indice];
+        }
         for (auto* bloc : blocsOperatoires) {
             if (bloc && bloc->getId() == blocId) {
                 return bloc;
@@ -625,7 +1154,11 @@ private:
     /**
      * Trouve une équipe médicale par ID
      */
-    EquipeMedicale* trouverEquipe(int equipeId) {
+    EquipeMedicale* trouverEquipe(int equipeId) const {
+        size_t indice = indiceRessource(equipeId);
+        if (indice < equipesDisponibles.size() && equipesDisponibles[indice]->getId() == equipeId) {
+            return equipesDisponibles[indice];
+        }
         for (auto* equipe : equipesDisponibles) {
             if (equipe && equipe->getId() == equipeId) {
                 return equipe;
@@ -634,12 +1167,44 @@ private:
         return nullptr;
     }
 
+    /**
+     * Enregistre l'état courant pour les minutes qui commencent avant horodatage
+     */
+    void enregistrerSeries(time_t horodatage) {
+        if (horodatage <= series.getHorodatageProchaineMinute()) return;
+        
+        series.enregistrerJusqua(horodatage, SeriesIndicateurs::Valeurs{
+            salleAttente->getNombrePatients(),
+            static_cast<int32_t>(blocsOperatoires.size()) - ressourcesLibres.getNombreBlocsLibres(),
+            ressourcesLibres.getNombreEquipesLibres(),
+            salleReveil->getNombrePatients()
+        });
+    }
+
     /**
      * Calcule le temps écoulé en minutes depuis le début
      */
     int getTempsEcouleMinutes() const {
-        if (tempsDebutReel == 0) return 0;
-        return static_cast<int>(std::difftime(tempsSimulation, tempsDebutReel) / 60);
+        return horloge.getMinutesEcoulees();
+    }
+
+    /**
+     * Blocs bloqués faute de lit de réveil: file en cours et temps cumulé par bloc
+     */
+    nlohmann::json getBlocageReveilJson() const {
+        nlohmann::json parBloc = nlohmann::json::array();
+        for (const BlocOperatoire* bloc : blocsOperatoires) {
+            parBloc.push_back({
+                {"blocId", bloc->getId()},
+                {"bloque", bloc->estBloque()},
+                {"nombreBlocages", bloc->getNombreBlocages()},
+                {"tempsBlocageMinutes", bloc->getTempsBlocageMinutes(horloge.getMaintenant())}
+            });
+        }
+        return nlohmann::json{
+            {"blocsBloques", blocsBloques.size()},
+            {"parBloc", parBloc}
+        };
     }
 
 public:
@@ -649,7 +1214,7 @@ public:
     nlohmann::json getEtatActuel() const {
         // Mettre à jour les compteurs en temps réel
         int nbAttente = salleAttente->getNombrePatients();
-        int nbOperation = Scheduler::compterBlocsOccupes(blocsOperatoires);
+        int nbOperation = ressourcesLibres.getNombreBlocsEnOperation();
         int nbReveil = salleReveil->getNombrePatients();
         
         return nlohmann::json{
@@ -657,6 +1222,9 @@ public:
             {"nom", nom},
             {"etat", etatSimulationToString(etat)},
             {"algorithme", algorithmeToString(algorithme)},
+            {"graine", generateur->getGraine()},
+            {"identifiantFlux", generateur->getIdentifiantFlux()},
+            {"niveauJournal", niveauJournalToString(journal.getNiveau())},
             {"tempsEcouleMinutes", getTempsEcouleMinutes()},
             {"dureeSimulationMinutes", dureeSimulationMinutes},
             {"progression", (getTempsEcouleMinutes() * 100.0) / dureeSimulationMinutes},
@@ -665,9 +1233,30 @@ public:
             {"nombrePatientsEnAttente", nbAttente},
             {"nombrePatientsEnOperation", nbOperation},
             {"nombrePatientsEnReveil", nbReveil},
-            {"nombreBlocsLibres", Scheduler::compterBlocsDisponibles(blocsOperatoires)},
-            {"nombreBlocsOccupes", Scheduler::compterBlocsOccupes(blocsOperatoires)},
-            {"nombreEquipesDisponibles", Scheduler::compterEquipesDisponibles(equipesDisponibles)}
+            {"nombreBlocsLibres", ressourcesLibres.getNombreBlocsLibres()},
+            {"nombreBlocsOccupes", ressourcesLibres.getNombreBlocsEnOperation()},
+            {"nombreEquipesDisponibles", ressourcesLibres.getNombreEquipesLibres()},
+            {"equipesSpecialisees", ressourcesLibres.estSpecialise()},
+            {"preemptionUrgences", preemptionUrgences},
+            {"nombreBlocsEnPreparation", ressourcesLibres.getBlocsEnPreparation().getNombre()},
+            {"reserveUrgences", reserveUrgences},
+            {"calendrier", {
+                {"mode", modeCalendrierToString(calendrier.getMode())},
+                {"evenementsEnAttente", calendrier.getTaille()},
+                {"evenementsTraites", nombreEvenementsTraites},
+                {"evenementsAnnules", calendrier.getNombreAnnulations()},
+                {"evenementsReplanifies", calendrier.getNombreReplanifications()},
+                {"evenementsPerimes", nombreEvenementsPerimes},
+                {"annulesEnAttente", calendrier.getNombreAnnulesEnAttente()},
+                {"compactages", calendrier.getNombreCompactages()},
+                {"taillePool", calendrier.getTaillePool()}
+            }},
+            {"salleReveil", salleReveil->getResumeJson(horloge.getMaintenant())},
+            {"blocageReveil", getBlocageReveilJson()},
+            {"series", {
+                {"nombreMinutes", series.getNombreMinutes()},
+                {"octets", series.getOctets()}
+            }}
         };
     }
 
@@ -681,35 +1270,55 @@ public:
     }
 
     /**
-     * Retourne les derniers événements (JSON)
+     * Événements récents traités après le numéro depuis (0 = toute la fenêtre)
+     * "dernierNumero" sert de curseur pour l'appel suivant; "tronque" indique
+     * que des événements ont été écrasés avant d'être lus
      */
-    nlohmann::json getEvenements() const {
+    nlohmann::json getEvenements(uint64_t depuis = 0) const {
         nlohmann::json events = nlohmann::json::array();
-        for (const auto& evt : historiqueEvenements) {
-            events.push_back(evt.toJson());
-        }
+        historiqueEvenements.parcourirDepuis(depuis, [&](const EvenementHistorique& entree) {
+            events.push_back(enrichirEvenement(entree).toJson());
+        });
         return nlohmann::json{
             {"simulationId", id},
-            {"events", events}
+            {"events", events},
+            {"depuis", depuis},
+            {"dernierNumero", historiqueEvenements.getDernierNumero()},
+            {"tronque", depuis > 0 && historiqueEvenements.estTronqueDepuis(depuis)}
         };
     }
 
+    /**
+     * Séries des indicateurs sur [debutMinute, finMinute) (minutes depuis le
+     * début, finMinute < 0: jusqu'à la dernière), voir SeriesIndicateurs::extraire
+     */
+    nlohmann::json getSeries(int64_t debutMinute, int64_t finMinute, int64_t resolution, size_t pointsMax) const {
+        auto json = series.extraire(debutMinute, finMinute, resolution, pointsMax);
+        json["simulationId"] = id;
+        return json;
+    }
+
     // Getters
     int getId() const { return id; }
     std::string getNom() const { return nom; }
     EtatSimulation getEtat() const { return etat; }
     double getFacteurVitesse() const { return facteurVitesse; }
+    uint64_t getNombreEvenementsTraites() const { return nombreEvenementsTraites; }
+    uint64_t getNombreEvenementsPerimes() const { return nombreEvenementsPerimes; }
+    const Statistics& getStats() const { return *stats; }
+    const RegistrePatients& getRegistre() const { return registre; }
+    size_t getOctetsArene() const { return arena.getOctetsUtilises(); }
+    size_t getNombreEvenementsEnAttente() const { return calendrier.getTaille(); }
     
     // Setters pour contrôle dynamique
     void setFacteurVitesse(double facteur) {
         facteurVitesse = facteur;
-        std::cout << "[SIMULATION] Facteur vitesse changé: ";
         if (facteurVitesse == 0.0) {
-            std::cout << "INSTANTANÉ" << std::endl;
+            JOURNAL_INFO(journal, "[SIMULATION] Facteur vitesse changé: INSTANTANÉ");
         } else if (facteurVitesse == 1.0) {
-            std::cout << "TEMPS RÉEL" << std::endl;
+            JOURNAL_INFO(journal, "[SIMULATION] Facteur vitesse changé: TEMPS RÉEL");
         } else {
-            std::cout << facteurVitesse << "x" << std::endl;
+            JOURNAL_INFO(journal, "[SIMULATION] Facteur vitesse changé: " << facteurVitesse << "x");
         }
     }
     
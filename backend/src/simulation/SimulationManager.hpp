@@ -20,6 +20,7 @@ private:
     std::map<int, std::thread*> threads;
     int prochainId;
     mutable std::mutex mutex;
+    Journal journal;
 
 public:
     /**
@@ -62,7 +63,7 @@ public:
         simulations[simId] = sim;
         threads[simId] = nullptr;
         
-        std::cout << "[MANAGER] Simulation #" << simId << " créée: " << config.nom << std::endl;
+        JOURNAL_INFO(journal, "[MANAGER] Simulation #" << simId << " créée: " << config.nom);
         
         return simId;
     }
@@ -90,7 +91,7 @@ public:
             sim->demarrer();
         });
         
-        std::cout << "[MANAGER] Simulation #" << simId << " démarrée" << std::endl;
+        JOURNAL_INFO(journal, "[MANAGER] Simulation #" << simId << " démarrée");
         
         return true;
     }
@@ -188,7 +189,7 @@ public:
         
         simulations.erase(it);
         
-        std::cout << "[MANAGER] Simulation #" << simId << " supprimée" << std::endl;
+        JOURNAL_INFO(journal, "[MANAGER] Simulation #" << simId << " supprimée");
         
         return true;
     }
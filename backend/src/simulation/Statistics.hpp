@@ -1,21 +1,30 @@
 #ifndef STATISTICS_HPP
 #define STATISTICS_HPP
 
-#include <vector>
+#include <array>
+#include <cstdint>
 #include <map>
 #include <algorithm>
-#include <numeric>
 #include <nlohmann/json.hpp>
 #include "../models/Patient.hpp"
 #include "../enums/PrioritePatient.hpp"
+#include "AccumulateurStatistique.hpp"
+#include "HorlogeVirtuelle.hpp"
 
 namespace AutoMed {
 
 /**
  * Collecteur de statistiques pour la simulation
+ *
+ * Les temps par patient (attente, opération, séjour) alimentent des
+ * accumulateurs en flux: mémoire constante quelle que soit la durée simulée
+ * et requêtes en O(1) (toJson() est appelé à chaque consultation de l'état).
+ * Les durées en cours se mesurent sur l'horloge virtuelle du moteur.
  */
 class Statistics {
 private:
+    const HorlogeVirtuelle* horloge;
+    
     // Compteurs généraux
     int nombrePatientsTotal;
     int nombrePatientsTraites;
@@ -24,31 +33,63 @@ private:
     int nombrePatientsEnReveil;
     
     // Temps par patient (en minutes)
-    std::vector<int> tempsAttenteParPatient;
-    std::vector<int> dureeOperationParPatient;
-    std::vector<int> tempsReveilParPatient;
-    std::vector<int> tempsSejourTotalParPatient;
+    AccumulateurStatistique tempsAttente;
+    AccumulateurStatistique dureeOperation;
+    AccumulateurStatistique tempsSejour;
     
-    // Par priorité
+    // Par priorité (temps d'attente: indice = priorité - URGENCE)
     std::map<PrioritePatient, int> nombrePatientParPriorite;
-    std::map<PrioritePatient, std::vector<int>> tempsAttenteParPriorite;
+    std::array<AccumulateurStatistique, 3> tempsAttenteParPriorite;
     
     // Horodatages
     time_t tempsDebutSimulation;
     time_t tempsFinSimulation;
 
+    // Coût de la spécialisation des équipes: périodes où un bloc et une équipe
+    // sont libres et des patients attendent, sans couple compatible
+    int nombreBlocagesSpecialisation;
+    time_t debutBlocageSpecialisation;      // 0 si pas de blocage en cours
+    int64_t secondesBlocageSpecialisation;
+
+    // Temps de calcul des décisions d'ordonnancement (si mesurés)
+    uint64_t nombreDecisions;
+    uint64_t nanosecondesDecisions;
+    uint64_t nanosecondesDecisionMax;
+    uint64_t nombreDepassementsBudget;      // Décisions plus longues que le budget
+    uint64_t nombreRecherchesInterrompues;  // Recherches arrêtées par le budget (anticipation)
+
+    // Préemption: électifs en préparation reportés au profit d'une urgence
+    int nombreReports;
+
+    // Salle de réveil pleine: blocs gardant un patient opéré (minutes par blocage)
+    AccumulateurStatistique tempsBlocageReveil;
+
+    AccumulateurStatistique& attentePriorite(PrioritePatient priorite) {
+        return tempsAttenteParPriorite[static_cast<size_t>(priorite) - static_cast<size_t>(PrioritePatient::URGENCE)];
+    }
+
 public:
     /**
      * Constructeur
      */
-    Statistics()
-        : nombrePatientsTotal(0),
+    explicit Statistics(const HorlogeVirtuelle& horloge)
+        : horloge(&horloge),
+          nombrePatientsTotal(0),
           nombrePatientsTraites(0),
           nombrePatientsEnAttente(0),
           nombrePatientsEnOperation(0),
           nombrePatientsEnReveil(0),
           tempsDebutSimulation(0),
-          tempsFinSimulation(0) {
+          tempsFinSimulation(0),
+          nombreBlocagesSpecialisation(0),
+          debutBlocageSpecialisation(0),
+          secondesBlocageSpecialisation(0),
+          nombreDecisions(0),
+          nanosecondesDecisions(0),
+          nanosecondesDecisionMax(0),
+          nombreDepassementsBudget(0),
+          nombreRecherchesInterrompues(0),
+          nombreReports(0) {
         
         // Initialiser les compteurs par priorité
         nombrePatientParPriorite[PrioritePatient::URGENCE] = 0;
@@ -68,6 +109,46 @@ public:
      */
     void terminer(time_t temps) {
         tempsFinSimulation = temps;
+        enregistrerBlocageSpecialisation(false, temps);
+    }
+
+    /**
+     * Met à jour l'état de blocage dû à la spécialisation (appelé après
+     * chaque tentative d'assignation)
+     */
+    void enregistrerBlocageSpecialisation(bool bloque, time_t temps) {
+        if (bloque && debutBlocageSpecialisation == 0) {
+            debutBlocageSpecialisation = temps;
+            nombreBlocagesSpecialisation++;
+        } else if (!bloque && debutBlocageSpecialisation != 0) {
+            secondesBlocageSpecialisation += static_cast<int64_t>(temps - debutBlocageSpecialisation);
+            debutBlocageSpecialisation = 0;
+        }
+    }
+
+    /**
+     * Enregistre la durée de calcul d'une décision d'ordonnancement
+     */
+    void enregistrerDecision(uint64_t nanosecondes, uint64_t budgetNanosecondes, bool rechercheInterrompue = false) {
+        nombreDecisions++;
+        nanosecondesDecisions += nanosecondes;
+        nanosecondesDecisionMax = std::max(nanosecondesDecisionMax, nanosecondes);
+        if (budgetNanosecondes > 0 && nanosecondes > budgetNanosecondes) nombreDepassementsBudget++;
+        if (rechercheInterrompue) nombreRecherchesInterrompues++;
+    }
+
+    /**
+     * Enregistre le report d'un patient en préparation (il retourne en attente)
+     */
+    void enregistrerReport() {
+        nombreReports++;
+    }
+
+    /**
+     * Enregistre un bloc débloqué (durée passée à attendre un lit de réveil)
+     */
+    void enregistrerBlocageReveil(int64_t secondes) {
+        tempsBlocageReveil.ajouter(secondes / 60);
     }
 
     /**
@@ -91,9 +172,9 @@ public:
         nombrePatientsEnOperation++;
         
         // Enregistrer le temps d'attente
-        int tempsAttente = patient->getTempsAttenteMinutes();
-        tempsAttenteParPatient.push_back(tempsAttente);
-        tempsAttenteParPriorite[patient->getPriorite()].push_back(tempsAttente);
+        int attente = patient->getTempsAttenteMinutes(horloge->getMaintenant());
+        tempsAttente.ajouter(attente);
+        attentePriorite(patient->getPriorite()).ajouter(attente);
     }
 
     /**
@@ -106,24 +187,22 @@ public:
         nombrePatientsEnReveil++;
         
         // Enregistrer la durée d'opération
-        int dureeOperation = patient->getDureeReelleMinutes();
-        dureeOperationParPatient.push_back(dureeOperation);
+        dureeOperation.ajouter(patient->getDureeReelleMinutes());
     }
 
     /**
-     * Enregistre la sortie d'un patient (fin de réveil)
+     * Enregistre la sortie d'un patient (fin de réveil) au temps virtuel donné
      */
-    void enregistrerSortie(Patient* patient) {
+    void enregistrerSortie(Patient* patient, time_t tempsSortie) {
         if (!patient) return;
         
         nombrePatientsEnReveil--;
         nombrePatientsTraites++;
         
         // Calculer le temps de séjour total
-        int tempsTotal = static_cast<int>(
-            std::difftime(std::time(nullptr), patient->getHorodatageArrivee()) / 60
-        );
-        tempsSejourTotalParPatient.push_back(tempsTotal);
+        tempsSejour.ajouter(static_cast<int>(
+            std::difftime(tempsSortie, patient->getHorodatageArrivee()) / 60
+        ));
     }
 
     /**
@@ -139,55 +218,43 @@ public:
      * Calcule le temps d'attente moyen (en minutes)
      */
     double getTempsAttenteMoyen() const {
-        if (tempsAttenteParPatient.empty()) return 0.0;
-        
-        int total = std::accumulate(tempsAttenteParPatient.begin(), 
-                                    tempsAttenteParPatient.end(), 0);
-        return static_cast<double>(total) / tempsAttenteParPatient.size();
+        return tempsAttente.getMoyenne();
     }
 
     /**
      * Calcule le temps d'attente maximum (en minutes)
      */
     int getTempsAttenteMax() const {
-        if (tempsAttenteParPatient.empty()) return 0;
-        return *std::max_element(tempsAttenteParPatient.begin(), 
-                                 tempsAttenteParPatient.end());
+        return static_cast<int>(tempsAttente.getMax());
     }
 
     /**
      * Calcule le temps d'attente moyen par priorité
      */
     double getTempsAttenteMoyenPriorite(PrioritePatient priorite) const {
-        auto it = tempsAttenteParPriorite.find(priorite);
-        if (it == tempsAttenteParPriorite.end() || it->second.empty()) {
-            return 0.0;
-        }
-        
-        int total = std::accumulate(it->second.begin(), it->second.end(), 0);
-        return static_cast<double>(total) / it->second.size();
+        return getAttentePriorite(priorite).getMoyenne();
     }
 
     /**
      * Calcule la durée moyenne des opérations
      */
     double getDureeOperationMoyenne() const {
-        if (dureeOperationParPatient.empty()) return 0.0;
-        
-        int total = std::accumulate(dureeOperationParPatient.begin(),
-                                    dureeOperationParPatient.end(), 0);
-        return static_cast<double>(total) / dureeOperationParPatient.size();
+        return dureeOperation.getMoyenne();
     }
 
     /**
      * Calcule le temps de séjour moyen total
      */
     double getTempsSejourMoyen() const {
-        if (tempsSejourTotalParPatient.empty()) return 0.0;
-        
-        int total = std::accumulate(tempsSejourTotalParPatient.begin(),
-                                    tempsSejourTotalParPatient.end(), 0);
-        return static_cast<double>(total) / tempsSejourTotalParPatient.size();
+        return tempsSejour.getMoyenne();
+    }
+
+    const AccumulateurStatistique& getTempsAttente() const { return tempsAttente; }
+    const AccumulateurStatistique& getDureeOperation() const { return dureeOperation; }
+    const AccumulateurStatistique& getTempsSejour() const { return tempsSejour; }
+
+    const AccumulateurStatistique& getAttentePriorite(PrioritePatient priorite) const {
+        return tempsAttenteParPriorite[static_cast<size_t>(priorite) - static_cast<size_t>(PrioritePatient::URGENCE)];
     }
 
     /**
@@ -198,7 +265,7 @@ public:
             return 0.0;
         }
         
-        time_t tempsActuel = (tempsFinSimulation > 0) ? tempsFinSimulation : std::time(nullptr);
+        time_t tempsActuel = (tempsFinSimulation > 0) ? tempsFinSimulation : horloge->getMaintenant();
         double heuresEcoulees = std::difftime(tempsActuel, tempsDebutSimulation) / 3600.0;
         
         if (heuresEcoulees <= 0) return 0.0;
@@ -206,6 +273,40 @@ public:
         return nombrePatientsTraites / heuresEcoulees;
     }
 
+    /**
+     * Temps total (minutes) pendant lequel la spécialisation a empêché une assignation
+     */
+    double getTempsBlocageSpecialisationMinutes() const {
+        return secondesBlocageSpecialisation / 60.0;
+    }
+
+    /**
+     * Part (%) de la durée simulée passée en blocage de spécialisation
+     */
+    double getTauxBlocageSpecialisation() const {
+        if (tempsDebutSimulation == 0 || tempsFinSimulation <= tempsDebutSimulation) return 0.0;
+        double secondesTotales = std::difftime(tempsFinSimulation, tempsDebutSimulation);
+        return secondesBlocageSpecialisation * 100.0 / secondesTotales;
+    }
+
+    int getNombreBlocagesSpecialisation() const { return nombreBlocagesSpecialisation; }
+
+    /**
+     * Temps moyen de calcul d'une décision (microsecondes)
+     */
+    double getTempsDecisionMoyenMicrosecondes() const {
+        return nombreDecisions > 0 ? nanosecondesDecisions / 1000.0 / nombreDecisions : 0.0;
+    }
+
+    double getTempsDecisionMaxMicrosecondes() const { return nanosecondesDecisionMax / 1000.0; }
+    uint64_t getNombreDecisions() const { return nombreDecisions; }
+    uint64_t getNanosecondesDecisions() const { return nanosecondesDecisions; }
+    uint64_t getNanosecondesDecisionMax() const { return nanosecondesDecisionMax; }
+    uint64_t getNombreDepassementsBudget() const { return nombreDepassementsBudget; }
+    uint64_t getNombreRecherchesInterrompues() const { return nombreRecherchesInterrompues; }
+    int getNombreReports() const { return nombreReports; }
+    const AccumulateurStatistique& getTempsBlocageReveil() const { return tempsBlocageReveil; }
+
     /**
      * Calcule le taux d'occupation des blocs (nécessite données externes)
      * Cette méthode sera appelée depuis SimulationEngine
@@ -244,18 +345,42 @@ public:
             {"dureeOperationMoyenne", getDureeOperationMoyenne()},
             {"tempsSejourMoyen", getTempsSejourMoyen()},
             {"debitPatients", getDebitPatients()},
+            {"specialisation", {
+                {"nombreBlocages", nombreBlocagesSpecialisation},
+                {"tempsBlocageMinutes", getTempsBlocageSpecialisationMinutes()},
+                {"tauxBlocage", getTauxBlocageSpecialisation()}
+            }},
+            {"decisions", {
+                {"nombre", nombreDecisions},
+                {"tempsMoyenMicrosecondes", getTempsDecisionMoyenMicrosecondes()},
+                {"tempsMaxMicrosecondes", getTempsDecisionMaxMicrosecondes()},
+                {"depassementsBudget", nombreDepassementsBudget},
+                {"recherchesInterrompues", nombreRecherchesInterrompues}
+            }},
+            {"preemption", {
+                {"nombreReports", nombreReports}
+            }},
+            {"blocageReveil", tempsBlocageReveil.toJson()},
+            {"distributions", {
+                {"tempsAttente", tempsAttente.toJson()},
+                {"dureeOperation", dureeOperation.toJson()},
+                {"tempsSejour", tempsSejour.toJson()}
+            }},
             {"parPriorite", {
                 {"URGENCE", {
                     {"nombre", getNombrePatientsPriorite(PrioritePatient::URGENCE)},
-                    {"tempsAttenteMoyen", getTempsAttenteMoyenPriorite(PrioritePatient::URGENCE)}
+                    {"tempsAttenteMoyen", getTempsAttenteMoyenPriorite(PrioritePatient::URGENCE)},
+                    {"tempsAttenteP90", getAttentePriorite(PrioritePatient::URGENCE).getQuantile(0.90)}
                 }},
                 {"ELECTIVE", {
                     {"nombre", getNombrePatientsPriorite(PrioritePatient::ELECTIVE)},
-                    {"tempsAttenteMoyen", getTempsAttenteMoyenPriorite(PrioritePatient::ELECTIVE)}
+                    {"tempsAttenteMoyen", getTempsAttenteMoyenPriorite(PrioritePatient::ELECTIVE)},
+                    {"tempsAttenteP90", getAttentePriorite(PrioritePatient::ELECTIVE).getQuantile(0.90)}
                 }},
                 {"AMBULATOIRE", {
                     {"nombre", getNombrePatientsPriorite(PrioritePatient::AMBULATOIRE)},
-                    {"tempsAttenteMoyen", getTempsAttenteMoyenPriorite(PrioritePatient::AMBULATOIRE)}
+                    {"tempsAttenteMoyen", getTempsAttenteMoyenPriorite(PrioritePatient::AMBULATOIRE)},
+                    {"tempsAttenteP90", getAttentePriorite(PrioritePatient::AMBULATOIRE).getQuantile(0.90)}
                 }}
             }}
         };
@@ -274,8 +399,25 @@ public:
         oss << "En réveil: " << nombrePatientsEnReveil << "\n";
         oss << "Temps attente moyen: " << getTempsAttenteMoyen() << " min\n";
         oss << "Temps attente max: " << getTempsAttenteMax() << " min\n";
+        oss << "Temps attente p50/p90/p99: " << tempsAttente.getQuantile(0.50) << " / "
+            << tempsAttente.getQuantile(0.90) << " / " << tempsAttente.getQuantile(0.99) << " min\n";
         oss << "Durée opération moyenne: " << getDureeOperationMoyenne() << " min\n";
         oss << "Débit: " << getDebitPatients() << " patients/heure\n";
+        if (nombreBlocagesSpecialisation > 0) {
+            oss << "Blocage spécialisation: " << getTempsBlocageSpecialisationMinutes() << " min ("
+                << getTauxBlocageSpecialisation() << "%)\n";
+        }
+        if (nombreReports > 0) {
+            oss << "Électifs reportés pour une urgence: " << nombreReports << "\n";
+        }
+        if (tempsBlocageReveil.getNombre() > 0) {
+            oss << "Blocs bloqués (réveil plein): " << tempsBlocageReveil.getNombre() << " fois, "
+                << tempsBlocageReveil.getSomme() << " min (max " << tempsBlocageReveil.getMax() << ")\n";
+        }
+        if (nombreDecisions > 0) {
+            oss << "Décisions: " << nombreDecisions << " (moy. " << getTempsDecisionMoyenMicrosecondes()
+                << " µs, max " << getTempsDecisionMaxMicrosecondes() << " µs)\n";
+        }
         oss << "==============================\n";
         return oss.str();
     }
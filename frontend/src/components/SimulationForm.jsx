@@ -55,6 +55,10 @@ const SimulationForm = ({ onSimulationCreated, onCancel }) => {
     { value: "FCFS", label: "FCFS - First Come First Served" },
     { value: "SJF", label: "SJF - Shortest Job First" },
     { value: "PRIORITY", label: "PRIORITY - Par Priorité" },
+    { value: "EDF", label: "EDF - Échéance la plus proche" },
+    { value: "WSJF", label: "WSJF - Durée pondérée par la priorité" },
+    { value: "VIEILLISSEMENT", label: "VIEILLISSEMENT - Priorité avec vieillissement" },
+    { value: "ANTICIPATION", label: "ANTICIPATION - Plan sur un horizon (électifs programmés)" },
     { value: "RR", label: "RR - Round Robin" },
   ];
 
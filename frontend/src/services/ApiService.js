@@ -136,9 +136,12 @@ class ApiService {
     }
   }
 
-  async getSimulationEvents(simId) {
+  async getSimulationEvents(simId, depuis = 0) {
     try {
-      const response = await this.api.get(`/simulation/${simId}/events`);
+      // depuis: dernierNumero de la réponse précédente (0 = toute la fenêtre)
+      const response = await this.api.get(`/simulation/${simId}/events`, {
+        params: depuis > 0 ? { depuis } : {},
+      });
       return response.data;
     } catch (error) {
       console.error("❌ Get simulation events error:", error);